@@ -0,0 +1,306 @@
+﻿#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include "../tsp_types.hpp"
+
+//主要な計算部分の1回あたりの実行時間[ns/op]を測定し，基準値と比較する
+//出力形式 kernel,n,ns_per_op
+//同梱のbaseline.csvは Intel(R) Xeon(R) Processor 上の g++ 12.2 で，このディレクトリで次の最初の2行を実行して作った値
+//基準値は計測したマシンでしか意味を持たないため，比較するマシンで同じように作り直してから3行目のように比較する
+//	g++ -std=c++17 -O2 -pthread -I.. micro_benchmark.cpp -o micro_benchmark
+//	./micro_benchmark -o baseline.csv
+//	./micro_benchmark -b baseline.csv -threshold 10
+
+namespace {
+	using graph_type = okl::tsp::graph_type;
+	using solution_type = okl::tsp::solution_type;
+	using set_type = okl::tsp::set_type;
+	using id_type = okl::tsp::id_type;
+	using matrix_type = graph_type::adjacent_matrix_type;
+
+	//最適化による計算の削除を防ぐための書き込み先
+	volatile std::int_least64_t sink = 0;
+
+	/*!
+	 * @brief			1回あたりの実行時間を測定する
+	 * @param[in]		__min_time 最小測定時間[s]
+	 * @param[in]		__ops __functionの1回の呼び出しで行う処理回数
+	 * @param[in]		__function 処理関数
+	 * @return			double	1回あたりの実行時間[ns]を返す
+	 * @detail			最小測定時間を超えるまで呼び出し回数を倍にして測定を繰り返し，3回測定した最小値を返す
+	 */
+	template<class __Function>
+	double measure(const double __min_time, const std::size_t __ops, __Function __function)
+	{
+		using clock = std::chrono::steady_clock;
+		double _best = std::numeric_limits<double>::max();
+		for (int _repeat = 0; _repeat < 3; ++_repeat) {
+			for (std::size_t _calls = 1;; _calls *= 2) {
+				const auto _start = clock::now();
+				for (std::size_t _call = 0; _call < _calls; ++_call) {
+					__function();
+				}
+				const std::chrono::duration<double> _elapsed = clock::now() - _start;
+				if (__min_time <= _elapsed.count()) {
+					_best = std::min(_best, _elapsed.count() * 1e9 / static_cast<double>(_calls * __ops));
+					break;
+				}
+			}
+		}
+		return _best;
+	}
+
+	/*!
+	 * @brief			一様乱数配置の問題例を生成する
+	 * @param[in]		__size 頂点数
+	 * @param[in]		__seed シード
+	 * @param[out]		__graph グラフクラス
+	 * @param[out]		__solution 解クラス ランダムな巡回路
+	 */
+	void makeInstance(const std::size_t __size, const std::seed_seq::result_type __seed, graph_type& __graph, solution_type& __solution)
+	{
+		okl::Random<> _random(__seed);
+		__graph.resize(static_cast<graph_type::size_type>(__size));
+		__solution.resize(static_cast<solution_type::size_type>(__size));
+		for (std::size_t _id = 0; _id < __size; ++_id) {
+			okl::tsp::vertex_type _vertex;
+			_vertex.setId(static_cast<id_type>(_id));
+			_vertex.setPostion(_random.uniform_real(0.0, 1000.0), _random.uniform_real(0.0, 1000.0));
+			__graph.addVertex(_vertex);
+			__solution.addNode(static_cast<id_type>(_id));
+		}
+		for (const auto& _start_vertex : __graph.vertices()) {
+			for (const auto& _end_vertex : __graph.vertices()) {
+				__graph.addDirectedEdge(_start_vertex.id(), _end_vertex.id(), static_cast<okl::tsp::edge_type>(okl::tsp::vertex_type::distance(_start_vertex, _end_vertex, "EUC_2D")));
+			}
+		}
+		__graph.updateInfo();
+
+		std::vector<id_type> _nodes(__solution.nodes().begin(), __solution.nodes().end());
+		std::shuffle(_nodes.begin(), _nodes.end(), _random.engin());
+		for (const auto _node_id : _nodes) {
+			__solution.setRouteOrder(__graph, _node_id);
+		}
+		__solution.calculateCost(__graph);
+	}
+
+	/*!
+	 * @brief			母集団の世代交代と走査の1回あたりの実行時間を測定する
+	 * @param[in]		__name 測定項目名の接頭辞
+	 * @param[in]		__min_time 最小測定時間[s]
+	 * @param[in]		__graph グラフクラス
+	 * @param[in]		__solution 個体の元にする解
+	 * @param[out]		__results 測定結果の追加先
+	 * @detail			現世代に個体を置き，現世代の複製と削除(個体1つあたり)と現世代の全巡回路の走査(頂点1つあたり)を測定する
+	 *				- __Population			母集団型
+	 */
+	template<class __Population>
+	void measurePopulation(const std::string& __name, const double __min_time, const graph_type& __graph, const solution_type& __solution, std::vector<std::tuple<std::string, std::size_t, double>>& __results)
+	{
+		using individual_type = typename __Population::individual_type;
+		constexpr std::size_t pop_size = 32;
+		const auto _size = __solution.route().size();
+
+		individual_type _individual;
+		_individual.resize(static_cast<typename individual_type::size_type>(_size));
+		for (const auto _node_id : __solution.nodes()) {
+			_individual.addNode(_node_id);
+		}
+		for (const auto _node_id : __solution.route()) {
+			_individual.setRouteOrder(__graph, _node_id);
+		}
+		_individual.calculateCost(__graph);
+
+		auto _population = std::make_unique<__Population>();
+		_population->resize(static_cast<typename __Population::size_type>(_size));
+		for (std::size_t _count = 0; _count < pop_size; ++_count) {
+			_population->born() = _individual;
+		}
+		_population->advanceGeneration();
+
+		std::vector<typename __Population::key_type> _ids;
+		_ids.reserve(pop_size);
+		__results.emplace_back(__name + "::copy", _size, measure(__min_time, pop_size, [&]() {
+			_ids.clear();
+			_population->born(pop_size, _ids);
+			auto _id = _ids.begin();
+			for (const auto _parent_id : _population->present_generation()) {
+				_population->individual(*_id++) = _population->individual(_parent_id);
+			}
+			sink = sink + _population->individual(_ids.front()).cost();
+			for (const auto _child_id : _ids) {
+				_population->kill(_child_id);
+			}
+		}));
+
+		__results.emplace_back(__name + "::scan", _size, measure(__min_time, pop_size * _size, [&]() {
+			std::int_least64_t _sum = 0;
+			for (const auto _individual_id : _population->present_generation()) {
+				for (const auto _node_id : _population->individual(_individual_id).route()) {
+					_sum += _node_id;
+				}
+			}
+			sink = sink + _sum;
+		}));
+	}
+
+	/*!
+	 * @brief			基準値を読み込む
+	 * @param[in]		__path 基準値ファイルパス
+	 * @return			std::map	(kernel, n)ごとの基準値[ns/op]を返す
+	 */
+	std::map<std::pair<std::string, std::size_t>, double> loadBaseline(const std::string& __path)
+	{
+		std::map<std::pair<std::string, std::size_t>, double> _baseline;
+		std::ifstream _fin(__path);
+		std::string _line;
+		std::getline(_fin, _line);
+		while (std::getline(_fin, _line)) {
+			std::istringstream _stream(_line);
+			std::string _kernel, _size, _ns;
+			if (std::getline(_stream, _kernel, ',') && std::getline(_stream, _size, ',') && std::getline(_stream, _ns, ',')) {
+				_baseline[{ _kernel, std::stoul(_size) }] = std::stod(_ns);
+			}
+		}
+		return _baseline;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	okl::CommandLine cmd;
+	cmd.addOption("sizes", ' ', "100,1000,5000", "頂点数 カンマ区切り");
+	cmd.addOption("min_time", ' ', "0.1", "各測定の最小測定時間[s]");
+	cmd.addOption("seed", ' ', "1", "問題例生成シード");
+	cmd.addOption("output", 'o', "", "測定結果CSV出力パス 空なら出力しない");
+	cmd.addOption("baseline", 'b', "", "比較する基準値CSVパス 空なら比較しない");
+	cmd.addOption("threshold", ' ', "10", "基準値より遅いと判定する割合[%]");
+	cmd.parse(argc, argv);
+
+	const auto _min_time = std::stod(cmd.getParameter("min_time"));
+	const auto _seed = static_cast<std::seed_seq::result_type>(std::stoul(cmd.getParameter("seed")));
+	std::vector<std::size_t> _sizes;
+	{
+		std::istringstream _stream(cmd.getParameter("sizes"));
+		for (std::string _size; std::getline(_stream, _size, ',');) {
+			_sizes.push_back(std::stoul(_size));
+		}
+	}
+
+	std::vector<std::tuple<std::string, std::size_t, double>> _results;
+	for (const auto _size : _sizes) {
+		graph_type _graph;
+		solution_type _solution;
+		makeInstance(_size, _seed, _graph, _solution);
+
+		//測定で用いるランダムな添字の組は事前に生成する
+		okl::Random<> _random(_seed);
+		std::vector<std::pair<std::size_t, std::size_t>> _pairs(4096);
+		for (auto& [_a, _b] : _pairs) {
+			_a = _random.uniform_int<std::size_t>(0, _size - 1);
+			do {
+				_b = _random.uniform_int<std::size_t>(0, _size - 1);
+			} while (_a == _b);
+		}
+
+		_results.emplace_back("gaincostAfterRouteSwap", _size, measure(_min_time, _pairs.size(), [&]() {
+			std::int_least64_t _sum = 0;
+			for (const auto& [_a, _b] : _pairs) {
+				_sum += _solution.gaincostAfterRouteSwap(_graph, _a, _b);
+			}
+			sink = sink + _sum;
+		}));
+
+		_results.emplace_back("routeSwap", _size, measure(_min_time, _pairs.size(), [&]() {
+			for (const auto& [_a, _b] : _pairs) {
+				_solution.routeSwap(_graph, _a, _b, 0);
+			}
+			sink = sink + _solution.route()[0];
+		}));
+
+		matrix_type _matrix;
+		_matrix.resize(static_cast<typename matrix_type::size_type>(_size));
+		for (std::size_t _row = 0; _row < _size; ++_row) {
+			for (std::size_t _column = _row; _column < _size; ++_column) {
+				_matrix.set(static_cast<typename matrix_type::key_type>(_row), static_cast<typename matrix_type::key_type>(_column), _graph.edge(static_cast<id_type>(_row), static_cast<id_type>(_column)));
+			}
+		}
+		_results.emplace_back("SymmetricMatrix::operator()", _size, measure(_min_time, _pairs.size(), [&]() {
+			std::int_least64_t _sum = 0;
+			for (const auto& [_a, _b] : _pairs) {
+				_sum += _matrix(static_cast<typename matrix_type::key_type>(_a), static_cast<typename matrix_type::key_type>(_b));
+			}
+			sink = sink + _sum;
+		}));
+
+		set_type _set;
+		_set.reserve(static_cast<typename set_type::size_type>(_size));
+		_results.emplace_back("HashSet::insert+erase", _size, measure(_min_time, 2 * _size, [&]() {
+			for (std::size_t _id = 0; _id < _size; ++_id) {
+				_set.insert(static_cast<id_type>(_id));
+			}
+			for (std::size_t _id = 0; _id < _size; ++_id) {
+				_set.erase(static_cast<id_type>(_id));
+			}
+			sink = sink + _set.size();
+		}));
+
+		for (std::size_t _id = 0; _id < _size; ++_id) {
+			_set.insert(static_cast<id_type>(_id));
+		}
+		_results.emplace_back("HashSet::shuffle", _size, measure(_min_time, _size, [&]() {
+			_set.shuffle(_random.engin());
+			sink = sink + _set.front();
+		}));
+
+		_results.emplace_back("Random::uniform_int", _size, measure(_min_time, 4096, [&]() {
+			std::size_t _sum = 0;
+			for (int _count = 0; _count < 4096; ++_count) {
+				_sum += _random.uniform_int<std::size_t>(0, _size - 1);
+			}
+			sink = sink + static_cast<std::int_least64_t>(_sum);
+		}));
+
+		//個体ごとに巡回路を確保する母集団と，全個体の巡回路を1つの連続領域にまとめる母集団を比べる
+		measurePopulation<okl::Population<solution_type, 64>>("Population", _min_time, _graph, _solution, _results);
+		measurePopulation<okl::tsp::arena_population_type<64>>("ArenaPopulation", _min_time, _graph, _solution, _results);
+	}
+
+	std::map<std::pair<std::string, std::size_t>, double> _baseline;
+	if (!cmd.getParameter("baseline").empty()) {
+		_baseline = loadBaseline(cmd.getParameter("baseline"));
+	}
+	const auto _threshold = 1.0 + std::stod(cmd.getParameter("threshold")) / 100.0;
+
+	bool _is_regressed = false;
+	std::cout << std::left << std::setw(28) << "kernel" << std::right << std::setw(9) << "n" << std::setw(12) << "ns/op";
+	if (!_baseline.empty()) {
+		std::cout << std::setw(12) << "baseline" << std::setw(9) << "ratio";
+	}
+	std::cout << std::endl;
+	for (const auto& [_kernel, _size, _ns] : _results) {
+		std::cout << std::left << std::setw(28) << _kernel << std::right << std::setw(9) << _size << std::setw(12) << std::fixed << std::setprecision(2) << _ns;
+		const auto _base = _baseline.find({ _kernel, _size });
+		if (_base != _baseline.end()) {
+			const auto _ratio = _ns / _base->second;
+			std::cout << std::setw(12) << _base->second << std::setw(9) << _ratio;
+			if (_threshold < _ratio) {
+				std::cout << "  SLOWER";
+				_is_regressed = true;
+			}
+		}
+		std::cout << std::endl;
+	}
+
+	if (!cmd.getParameter("output").empty()) {
+		std::ofstream _fout(cmd.getParameter("output"));
+		_fout << "kernel,n,ns_per_op" << std::endl;
+		for (const auto& [_kernel, _size, _ns] : _results) {
+			_fout << _kernel << "," << _size << "," << std::fixed << std::setprecision(3) << _ns << std::endl;
+		}
+	}
+	return _is_regressed ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+﻿#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "../tsp_types.hpp"
+
+//生成した問題例の頂点数を増やしながら，問題例の書き込み，読み込み(距離行列の構築)，
+//2-opt近傍の1回の全走査，1回の局所探索の実行時間と距離行列の推定メモリ量を測定する
+//出力形式 distribution,n,memory_mib,write_s,load_s,scan_s,ls_s 測定しなかった段階は空
+
+namespace {
+	using graph_type = okl::tsp::graph_type;
+	using solution_type = okl::tsp::solution_type;
+	using id_type = okl::tsp::id_type;
+
+	//最適化による計算の削除を防ぐための書き込み先
+	volatile std::int_least64_t sink = 0;
+
+	/*!
+	 * @brief			実行時間を測定する
+	 * @param[in]		__function 処理関数
+	 * @return			double	実行時間[s]を返す
+	 */
+	template<class __Function>
+	double measure(__Function __function)
+	{
+		const auto _start = std::chrono::steady_clock::now();
+		__function();
+		const std::chrono::duration<double> _elapsed = std::chrono::steady_clock::now() - _start;
+		return _elapsed.count();
+	}
+
+	/*!
+	 * @brief			測定値を文字列に変換する
+	 * @param[in]		__value 測定値 負なら測定していない
+	 * @return			std::string	測定していなければ空文字列を返す
+	 */
+	std::string toString(const double __value)
+	{
+		if (__value < 0) {
+			return "";
+		}
+		std::ostringstream _stream;
+		_stream << std::fixed << std::setprecision(6) << __value;
+		return _stream.str();
+	}
+}
+
+int main(int argc, char* argv[]) {
+	okl::CommandLine cmd;
+	cmd.addOption("sizes", ' ', "100,1000,10000,100000,1000000", "頂点数 カンマ区切り");
+	cmd.addOption("distribution", 'd', "uniform", "配置 uniform, clustered, grid");
+	cmd.addOption("type", ' ', "EUC_2D", "距離の種類 EUC_2D, EUC_2D_REAL");
+	cmd.addOption("seed", ' ', "1", "問題例生成と探索のシード");
+	cmd.addOption("work_dir_path", ' ', (std::filesystem::temp_directory_path() / "okl_scaling_benchmark").string(), "生成した問題例の書き込み先");
+	cmd.addOption("max_memory_size", ' ', "4096", "読み込む距離行列の推定メモリ量の上限[MiB] 超えたら読み込み以降を測定しない");
+	cmd.addOption("max_scan_size", ' ', "50000", "近傍の全走査を測定する最大頂点数");
+	cmd.addOption("max_ls_size", ' ', "1000", "局所探索を測定する最大頂点数");
+	cmd.addOption("output", 'o', "", "測定結果CSV出力パス 空なら出力しない");
+	cmd.parse(argc, argv);
+
+	const auto _seed = static_cast<std::seed_seq::result_type>(std::stoul(cmd.getParameter("seed")));
+	const auto _type = cmd.getParameter("type");
+	const auto _max_memory_size = std::stoull(cmd.getParameter("max_memory_size")) * 1024 * 1024;
+	std::vector<std::size_t> _sizes;
+	{
+		std::istringstream _stream(cmd.getParameter("sizes"));
+		for (std::string _size; std::getline(_stream, _size, ',');) {
+			_sizes.push_back(std::stoul(_size));
+		}
+	}
+	std::filesystem::create_directories(cmd.getParameter("work_dir_path"));
+
+	std::vector<std::tuple<std::size_t, double, double, double, double, double>> _results;
+	std::cout << std::setw(9) << "n" << std::setw(14) << "memory[MiB]" << std::setw(12) << "write[s]" << std::setw(12) << "load[s]" << std::setw(12) << "scan[s]" << std::setw(12) << "ls[s]" << std::endl;
+	for (const auto _size : _sizes) {
+		const auto _name = cmd.getParameter("distribution") + std::to_string(_size) + "_" + std::to_string(_seed);
+		const auto _path = (std::filesystem::path(cmd.getParameter("work_dir_path")) / (_name + ".tsp")).string();
+		const auto _memory_size = okl::tsp::estimateMemorySize<graph_type>(_size);
+		double _write_time = -1, _load_time = -1, _scan_time = -1, _ls_time = -1;
+
+		_write_time = measure([&]() {
+			std::ofstream _fout(_path);
+			okl::tsp::writeInstance(_fout, _name, okl::tsp::generatePositions(cmd.getParameter("distribution"), _size, _seed, 10000, _type == "EUC_2D_REAL"), _type);
+		});
+
+		//頂点IDの型で表せない頂点数や上限を超える距離行列は読み込まない
+		if (_size - 1 <= std::numeric_limits<id_type>::max() && _memory_size <= _max_memory_size) {
+			auto _problem = std::make_unique<std::tuple<okl::tsp::search, graph_type, okl::tsp::search_info_type, solution_type>>();
+			auto& [_search, _graph, _search_info, _solution] = *_problem;
+			const okl::tsp::instance_type _instance(_name, 0, _seed, _type);
+			_load_time = measure([&]() {
+				okl::tsp::load(_path, _instance, _graph, _search_info, _solution);
+			});
+
+			if (_size <= std::stoul(cmd.getParameter("max_scan_size"))) {
+				//読み込んだ解は探索の初期解として使うため，複製したランダムな巡回路で走査する
+				okl::Random<> _random(_seed);
+				auto _route_solution = _solution;
+				std::vector<okl::tsp::id_type> _nodes(_route_solution.nodes().begin(), _route_solution.nodes().end());
+				std::shuffle(_nodes.begin(), _nodes.end(), _random.engin());
+				for (const auto _node_id : _nodes) {
+					_route_solution.setRouteOrder(_graph, _node_id);
+				}
+				_route_solution.calculateCost(_graph);
+				_scan_time = measure([&]() {
+					std::int_least64_t _best = 0;
+					for (std::size_t _a = 0; _a < _size; ++_a) {
+						for (std::size_t _b = _a + 1; _b < _size; ++_b) {
+							_best = std::max<std::int_least64_t>(_best, _route_solution.gaincostAfterRouteSwap(_graph, _a, _b));
+						}
+					}
+					sink = sink + _best;
+				});
+			}
+
+			if (_size <= std::stoul(cmd.getParameter("max_ls_size"))) {
+				_search.resize(static_cast<okl::tsp::search::size_type>(_size));
+				_search_info.setRepeatTimes(1);
+				_ls_time = measure([&]() {
+					okl::run(1, 1, _seed, _graph, _search, _search_info, _solution);
+				});
+			}
+		}
+
+		std::cout << std::setw(9) << _size << std::setw(14) << std::fixed << std::setprecision(1) << static_cast<double>(_memory_size) / (1024 * 1024)
+			<< std::setw(12) << toString(_write_time) << std::setw(12) << toString(_load_time) << std::setw(12) << toString(_scan_time) << std::setw(12) << toString(_ls_time) << std::endl;
+		_results.emplace_back(_size, static_cast<double>(_memory_size) / (1024 * 1024), _write_time, _load_time, _scan_time, _ls_time);
+		std::filesystem::remove(_path);
+	}
+
+	if (!cmd.getParameter("output").empty()) {
+		std::ofstream _fout(cmd.getParameter("output"));
+		_fout << "distribution,n,memory_mib,write_s,load_s,scan_s,ls_s" << std::endl;
+		for (const auto& [_size, _memory_size, _write_time, _load_time, _scan_time, _ls_time] : _results) {
+			_fout << cmd.getParameter("distribution") << "," << _size << "," << std::fixed << std::setprecision(3) << _memory_size << ","
+				<< toString(_write_time) << "," << toString(_load_time) << "," << toString(_scan_time) << "," << toString(_ls_time) << std::endl;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,321 @@
+﻿#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "../tsp_types.hpp"
+
+//指定の探索を固定のシードと制限時間で実行し，
+//問題例ごとに指定時刻での最良解のギャップと目標ギャップ到達時間の分位点を出力する
+//ギャップの基準は既知の最良値，なければ基準値CSV(instance,reference)の値とする どちらもない問題例のギャップは求めない
+//既定では制限時間を頂点数に比例させ(頂点数100あたり0.2秒)，どの問題例でも分位点が有限になるようにする
+//ギャップを求める時刻は問題例ごとの制限時間に対する割合で指定する
+//同梱のreference.csvは既定の頂点数とシードで生成した問題例を次のように長時間解いた最良値
+//	./solver_benchmark -search ga -trial_num 8 -thread_num 8 -run_time 30 -time_scale_size 0 -reference_path "" -reference_output reference.csv
+//探索をカンマ区切りで指定すれば同じ問題例で順に実行し，CSVのsearch列で比べられる
+//	./solver_benchmark -search mls,ils,ga -run_time 1 -time_scale_size 0 -times 0.1,0.5,1 -output compare.csv
+//1コアでのgap@1sのp50[%] (uniform100_1 / uniform200_1 / uniform500_1)
+//	mls	2.54 / 6.37 / inf (1秒では最初の局所探索が終わらない)
+//	ils	0 / 0.049 / 0.41
+//	ga	0 / 0 / 0.10
+
+namespace {
+	using cost_type = okl::tsp::cost_type;
+	using cost_comparison_function = okl::tsp::cost_comparison_function;
+
+	/*!
+	 *  @brief      改善履歴記録クラス
+	 *  @details    試行ごとの最良解の改善時刻と解の値を記録する
+	 *				スレッドごとの探索情報クラスからの通知は試行の最良値を改善するとは限らないため，改善したものだけを記録する
+	 */
+	class TrajectoryRecorder : public okl::ImprovementSubscriber<cost_type>
+	{
+	public:
+		using event_type = okl::ImprovementSubscriber<cost_type>::event_type;
+
+		bool isSolutionRequired() const override { return false; }
+
+		std::string name() const override { return ""; }
+
+		void notify(const event_type& __event) override
+		{
+			std::lock_guard<std::mutex> _lock(this->mutex_);
+			auto& _trajectory = this->trajectories_[__event.trial_];
+			if (_trajectory.empty() || cost_comparison_function()(_trajectory.back().second, __event.cost_)) {
+				_trajectory.emplace_back(__event.time_, __event.cost_);
+			}
+		}
+
+		/*!
+		 * @brief			試行ごとの改善履歴を返す
+		 * @return			std::map	試行番号ごとの(時刻, 解の値)の列を返す
+		 */
+		const std::map<std::size_t, std::vector<std::pair<double, cost_type>>>& trajectories() const
+		{
+			return this->trajectories_;
+		}
+
+	private:
+		std::mutex mutex_;
+		std::map<std::size_t, std::vector<std::pair<double, cost_type>>> trajectories_;
+	};
+
+	/*!
+	 * @brief			分位点を返す
+	 * @param[in]		__values 値
+	 * @param[in]		__percent 分位[%]
+	 * @return			double	最近順位法による分位点を返す
+	 */
+	double percentile(std::vector<double> __values, const double __percent)
+	{
+		if (__values.empty()) {
+			return std::numeric_limits<double>::infinity();
+		}
+		std::sort(__values.begin(), __values.end());
+		const auto _rank = static_cast<std::size_t>(std::ceil(__percent / 100.0 * static_cast<double>(__values.size())));
+		return __values[std::min(__values.size(), std::max<std::size_t>(_rank, 1)) - 1];
+	}
+
+	/*!
+	 * @brief			数値を文字列に変換する
+	 * @param[in]		__value 数値
+	 * @return			std::string	既定の書式で変換した文字列を返す
+	 */
+	std::string toString(const double __value)
+	{
+		std::ostringstream _stream;
+		_stream << __value;
+		return _stream.str();
+	}
+
+	/*!
+	 * @brief			カンマ区切りの文字列を分割する
+	 * @param[in]		__string 文字列
+	 * @return			std::vector<std::string>	分割した文字列を返す
+	 */
+	std::vector<std::string> split(const std::string& __string)
+	{
+		std::vector<std::string> _values;
+		std::istringstream _stream(__string);
+		for (std::string _value; std::getline(_stream, _value, ',');) {
+			_values.push_back(_value);
+		}
+		return _values;
+	}
+
+	/*!
+	 * @brief			基準値を読み込む
+	 * @param[in]		__path 基準値CSVパス 1行目は見出し
+	 * @return			std::map	問題例名ごとの基準値を返す ファイルがなければ空
+	 */
+	std::map<std::string, cost_type> loadReferences(const std::string& __path)
+	{
+		std::map<std::string, cost_type> _references;
+		std::ifstream _fin(__path);
+		std::string _line;
+		std::getline(_fin, _line);
+		while (std::getline(_fin, _line)) {
+			const auto _values = split(_line);
+			if (_values.size() == 2) {
+				_references[_values[0]] = static_cast<cost_type>(std::stoll(_values[1]));
+			}
+		}
+		return _references;
+	}
+
+	/*!
+	 * @brief			問題例ごとに探索を実行し，結果を出力する
+	 * @param[in]		__search_name 結果CSVに書き込む探索名
+	 * @param[in]		__instances 問題例と読み込みパス
+	 * @param[in]		__trial_num 問題例ごとの試行回数
+	 * @param[in]		__thread_num 並列に実行する試行数
+	 * @param[in]		__run_time 試行ごとの制限時間[s]
+	 * @param[in]		__time_scale_size 制限時間を__run_timeとする頂点数 問題例ごとの制限時間を頂点数に比例させる 0なら比例させない
+	 * @param[in]		__times ギャップを求める時刻 制限時間に対する割合
+	 * @param[in]		__target_gap 目標ギャップ[%]
+	 * @param[in]		__pop_size 母集団サイズ
+	 * @param[in]		__references 問題例名ごとの基準値
+	 * @param[out]		__csv 結果CSV出力先
+	 * @param[out]		__reference_csv 全試行の最良値を基準値CSVとして書き込む出力先
+	 * @detail			- __Search			探索クラス
+	 */
+	template<class __Search>
+	void runBenchmark(const std::string& __search_name, const std::vector<std::pair<okl::tsp::instance_type, std::string>>& __instances, const std::size_t __trial_num, const std::size_t __thread_num, const double __run_time, const std::size_t __time_scale_size, const std::vector<double>& __times, const double __target_gap, const std::size_t __pop_size, const std::map<std::string, cost_type>& __references, std::ofstream& __csv, std::ofstream& __reference_csv)
+	{
+		std::cout << okl::format(__Search::info()) << std::endl;
+		for (const auto& [_instance, _path] : __instances) {
+			auto _problem = std::make_unique<std::tuple<__Search, okl::tsp::graph_type, okl::tsp::search_info_type, typename __Search::solution_type>>();
+			auto& [_search, _graph, _search_info, _solution] = *_problem;
+			okl::tsp::load(_path, _instance, _graph, _search_info, _solution);
+			_search.resize(static_cast<typename __Search::size_type>(_graph.vertices().size()));
+
+			const auto _recorder = std::make_shared<TrajectoryRecorder>();
+			_search_info.setBestKnownCost(_instance.best_known_cost());
+			_search_info.setRepeatTimes(0);
+			const double _run_time = __time_scale_size == 0 ? __run_time : __run_time * static_cast<double>(_graph.vertices().size()) / static_cast<double>(__time_scale_size);
+			_search_info.setRunTime(_run_time);
+			_search_info.setPopSize(static_cast<okl::tsp::search_info_type::size_type>(__pop_size));
+			_search_info.setTimeCheckInterval(1);
+			_search_info.setImprovementSubscriber(_recorder);
+
+			std::cout << _instance.name() << " n=" << _graph.vertices().size();
+			okl::run(__trial_num, __thread_num, _instance.initial_seed(), _graph, _search, _search_info, _solution);
+
+			if (__reference_csv) {
+				auto _best = std::numeric_limits<cost_type>::max();
+				for (const auto& [_trial, _trajectory] : _recorder->trajectories()) {
+					_best = std::min(_best, _trajectory.back().second);
+				}
+				__reference_csv << _instance.name() << "," << _best << std::endl;
+			}
+
+			//既知の最良値がなければ基準値CSVの値を基準とする 同じ実行の最良値は試行数や制限時間で変わるため用いない
+			cost_type _reference = _instance.best_known_cost();
+			if (_reference <= 0) {
+				const auto _found = __references.find(_instance.name());
+				if (_found == __references.end()) {
+					std::cout << std::endl << "  基準値がないため，ギャップを求めません" << std::endl;
+					continue;
+				}
+				_reference = _found->second;
+			}
+			const auto _gap = [_reference](const cost_type __cost) {
+				return 100.0 * static_cast<double>(__cost - _reference) / static_cast<double>(_reference);
+			};
+
+			//改善イベントのない試行も分位点の分母に含め，未到達(無限大)として扱う
+			std::vector<std::tuple<std::string, double, double, std::size_t>> _rows;
+			for (const auto _time_ratio : __times) {
+				const auto _time = _run_time * _time_ratio;
+				std::vector<double> _gaps(__trial_num, std::numeric_limits<double>::infinity());
+				std::size_t _reached = 0;
+				for (const auto& [_trial, _trajectory] : _recorder->trajectories()) {
+					auto& _gap_at_time = _gaps[_trial - 1];
+					for (const auto& [_event_time, _cost] : _trajectory) {
+						if (_time < _event_time) {
+							break;
+						}
+						_gap_at_time = _gap(_cost);
+					}
+					if (_gap_at_time != std::numeric_limits<double>::infinity()) {
+						++_reached;
+					}
+				}
+				_rows.emplace_back("gap@" + toString(_time) + "s[%]", percentile(_gaps, 50), percentile(_gaps, 90), _reached);
+			}
+
+			std::vector<double> _times_to_target(__trial_num, std::numeric_limits<double>::infinity());
+			std::size_t _reached = 0;
+			for (const auto& [_trial, _trajectory] : _recorder->trajectories()) {
+				for (const auto& [_event_time, _cost] : _trajectory) {
+					if (_gap(_cost) <= __target_gap) {
+						_times_to_target[_trial - 1] = _event_time;
+						++_reached;
+						break;
+					}
+				}
+			}
+			_rows.emplace_back("ttt(" + toString(__target_gap) + "%)[s]", percentile(_times_to_target, 50), percentile(_times_to_target, 90), _reached);
+
+			std::cout << "  reference=" << _reference << std::endl;
+			for (const auto& [_metric, _p50, _p90, _count] : _rows) {
+				std::cout << "  " << std::left << std::setw(16) << _metric << std::right << " p50=" << std::setw(10) << _p50 << " p90=" << std::setw(10) << _p90 << " (" << _count << "/" << __trial_num << ")" << std::endl;
+				if (__csv) {
+					__csv << __search_name << "," << _instance.name() << "," << _graph.vertices().size() << "," << _reference << "," << _metric << "," << _p50 << "," << _p90 << "," << _count << std::endl;
+				}
+			}
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	okl::CommandLine cmd;
+	cmd.addOption("search", ' ', "ils", "探索 mls, pmls, ils, ga, arena_ga, parallel_ga, island_gaのいずれか カンマ区切りで複数指定すれば順に実行する");
+	cmd.addOption("sizes", ' ', "100,200,500", "生成する一様乱数配置の問題例の頂点数 カンマ区切り");
+	cmd.addOption("instances_path", ' ', "", "問題例一覧ファイル(data/tsp.txtと同じ形式) 指定すれば生成した問題例の代わりに用いる");
+	cmd.addOption("instances_dir_path", ' ', "", "問題例一覧の問題例格納ディレクトリパス");
+	cmd.addOption("work_dir_path", ' ', (std::filesystem::temp_directory_path() / "okl_solver_benchmark").string(), "生成した問題例の書き込み先");
+	cmd.addOption("trial_num", 't', "10", "問題例ごとの試行回数");
+	cmd.addOption("run_time", 's', "0.2", "試行ごとの制限時間[s] time_scale_sizeが0でなければ頂点数time_scale_sizeあたりの制限時間");
+	cmd.addOption("time_scale_size", ' ', "100", "制限時間を頂点数に比例させる基準の頂点数 0なら全問題例でrun_timeとする");
+	cmd.addOption("times", ' ', "0.1,0.25,0.5,1", "ギャップを求める時刻の制限時間に対する割合 カンマ区切り");
+	cmd.addOption("target_gap", ' ', "1", "目標ギャップ[%]");
+	cmd.addOption("seed", ' ', "1", "問題例生成と試行のシード");
+	cmd.addOption("thread_num", ' ', "1", "並列に実行する試行数");
+	cmd.addOption("pop_size", 'p', "10", "母集団サイズ 遺伝的アルゴリズムのみで用いる");
+	cmd.addOption("output", 'o', "", "結果CSV出力パス 空なら出力しない");
+	cmd.addOption("reference_path", 'r', "reference.csv", "既知の最良値がない問題例のギャップの基準値CSVパス");
+	cmd.addOption("reference_output", ' ', "", "全試行の最良値を基準値CSVとして書き込むパス 空なら出力しない");
+	cmd.parse(argc, argv);
+
+	const auto _trial_num = std::stoul(cmd.getParameter("trial_num"));
+	const auto _run_time = std::stod(cmd.getParameter("run_time"));
+	const auto _time_scale_size = std::stoul(cmd.getParameter("time_scale_size"));
+	const auto _target_gap = std::stod(cmd.getParameter("target_gap"));
+	const auto _seed = static_cast<std::seed_seq::result_type>(std::stoul(cmd.getParameter("seed")));
+	std::vector<double> _times;
+	for (const auto& _time : split(cmd.getParameter("times"))) {
+		_times.push_back(std::stod(_time));
+	}
+
+	//問題例と読み込みパス
+	std::vector<std::pair<okl::tsp::instance_type, std::string>> _instances;
+	if (!cmd.getParameter("instances_path").empty()) {
+		for (const auto& _instance : okl::tsp::instance_type::load<okl::tsp::cost_comparison_function>(cmd.getParameter("instances_path"))) {
+			_instances.emplace_back(_instance, cmd.getParameter("instances_dir_path") + _instance.name() + ".tsp");
+		}
+	}
+	else {
+		std::filesystem::create_directories(cmd.getParameter("work_dir_path"));
+		for (const auto& _size : split(cmd.getParameter("sizes"))) {
+			const auto _name = "uniform" + _size + "_" + std::to_string(_seed);
+			const auto _path = (std::filesystem::path(cmd.getParameter("work_dir_path")) / (_name + ".tsp")).string();
+			std::ofstream _fout(_path);
+			okl::tsp::writeInstance(_fout, _name, okl::tsp::generateUniformPositions(std::stoul(_size), _seed));
+			_instances.emplace_back(okl::tsp::instance_type(_name, 0, _seed, "EUC_2D"), _path);
+		}
+	}
+
+	//基準値は出力先を開く前に読み込み，同じパスへの書き直しに備える
+	const auto _references = loadReferences(cmd.getParameter("reference_path"));
+	std::ofstream _reference_csv;
+	if (!cmd.getParameter("reference_output").empty()) {
+		_reference_csv.open(cmd.getParameter("reference_output"));
+		_reference_csv << "instance,reference" << std::endl;
+	}
+
+	std::ofstream _csv;
+	if (!cmd.getParameter("output").empty()) {
+		_csv.open(cmd.getParameter("output"));
+		_csv << "search,instance,n,reference,metric,p50,p90,reached" << std::endl;
+	}
+
+	const auto _thread_num = std::stoul(cmd.getParameter("thread_num"));
+	const auto _pop_size = std::stoul(cmd.getParameter("pop_size"));
+	for (const auto& _search_name : split(cmd.getParameter("search"))) {
+		if (_search_name == "mls") {
+			runBenchmark<okl::tsp::mls>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "pmls") {
+			runBenchmark<okl::tsp::pmls>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "ils") {
+			runBenchmark<okl::tsp::ils>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "ga") {
+			runBenchmark<okl::tsp::ga>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "arena_ga") {
+			runBenchmark<okl::tsp::arena_ga>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "parallel_ga") {
+			runBenchmark<okl::tsp::parallel_ga>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else if (_search_name == "island_ga") {
+			runBenchmark<okl::tsp::island_ga>(_search_name, _instances, _trial_num, _thread_num, _run_time, _time_scale_size, _times, _target_gap, _pop_size, _references, _csv, _reference_csv);
+		}
+		else {
+			std::cerr << _search_name << ": 未知の探索です" << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -21,13 +21,32 @@ int main(int argc, char* argv[]) {
 	//o̓pXw@Ŏw肳ꂽꍇCRtBOt@Cł̎w㏑
 	cmd.addOption("results_dir_path", ' ', _config["results_dir_path"], "ʏo̓fBNgpX");
 	cmd.addOption("log_dir_path", ' ', _config["log_dir_path"], "Oo̓fBNgpX");
+	cmd.addOption("tour_dir_path", ' ', _config["tour_dir_path"], "sƂ̍ŗǏHo̓fBNgpX Ȃo͂Ȃ");
+	cmd.addOption("improvement_dir_path", ' ', _config["improvement_dir_path"], "PCxg(ᖼ_improvement_.jsonl)o̓fBNgpX Ȃo͂Ȃ OtpCvwł");
+	cmd.addOption("checkpoint_dir_path", ' ', _config["checkpoint_dir_path"], "`FbN|Cg(ᖼ.ckpt)i[fBNgpX ȂۑȂ");
+	cmd.addOption("initial_tour_dir_path", ' ', _config["initial_tour_dir_path"], "H(ᖼ.tour)i[fBNgpX Ȃǂݍ܂Ȃ");
 	cmd.addOption("instances_path", ' ', _config["instances_path"], "ǂݍݖꗗt@Ci[pX");
 
 	//p[^[w@Ŏw肳ꂽꍇCRtBOt@Cł̎w㏑
 	cmd.addOption("trial_num", 't', _config["trial_num"], "s");
 	cmd.addOption("repeat_times", 'r', _config["repeat_times"], "JԂ");
 	cmd.addOption("run_time", 's', _config["run_time"], "s");
+	cmd.addOption("time_check_interval", ' ', _config["time_check_interval"], "sԂ̔Ԋu 艽񂲂ƂɎvǂނ");
 	cmd.addOption("pop_size", 'p', _config["pop_size"], "WcTCY");
+	cmd.addOption("thread_num", ' ', _config["thread_num"], "Ŝ̃Xbh 0Ȃn[hEFA̕");
+	cmd.addOption("memory_budget", ' ', _config["memory_budget"], "s̃[MB] 0ȂȂ");
+	cmd.addOption("prefetch_num", ' ', _config["prefetch_num"], "Tɐǂ݂ᐔ");
+	cmd.addOption("checkpoint_interval", ' ', _config["checkpoint_interval"], "`FbN|Cg̕ۑԊu sƂɕۑ邩");
+	cmd.addOption("resume", ' ', _config["resume"], "1Ȃ`FbN|CgĊJ");
+	cmd.addOption("improvement_solution", ' ', _config["improvement_solution"], "1ȂPCxgɏH");
+	cmd.addOption("trace_chunk_size", ' ', _config["trace_chunk_size"], "oCi`ŏރ`N̍s 0ȂeLXg`");
+	cmd.addOption("perf_counter", ' ', _config["perf_counter"], "1Ȃ玎sƋǏT̃n[hEFAJE^lʂׂ̗_perf_.csvɏ");
+	cmd.addOption("chrome_trace_path", ' ', _config["chrome_trace_path"], "ZqƒT̒iK̋ԂChrome trace-event`ŏރpX Ȃ珑܂Ȃ OKL_TRACE`ăRpCƂ̂");
+	cmd.addOption("chrome_trace_trial_interval", ' ', _config["chrome_trace_trial_interval"], "ԂL^鎎s̊Ԋu 1ȂSs");
+	cmd.addOption("chrome_trace_min_duration", ' ', _config["chrome_trace_min_duration"], "L^ŏԒ[us]");
+	cmd.addOption("chrome_trace_max_events", ' ', _config["chrome_trace_max_events"], "XbhƂ̍őԐ 0ȂȂ");
+	cmd.addOption("huge_page", ' ', _config["huge_page"], "s̊mە@ 0Ȃʏ̃y[W 1Ȃ瓧ߓIq[Wy[W 2Ȃhugetlbfs̃q[Wy[W(mۂłȂ1)");
+	cmd.addOption("dry_run", ' ', _config["dry_run"], "1ȂTɖႲƂ̕Kvʂ̌ςo͂ďI");
 
 	//w@Ŏw肳ꂽꍇCRtBOt@Cł̎w㏑
 	const std::string undefine_str = "-1";
@@ -68,25 +87,153 @@ int main(int argc, char* argv[]) {
 		_instances = okl::problem::instance_type::load<okl::problem::cost_comparison_function>(cmd.getParameter("instances_path"));
 	}
 
+	okl::HugePage::setMode(std::stoi(cmd.getParameter("huge_page").c_str()));
+
+	//H̎w肪ΏHJnTCȂΊ̒Tp
+	//T^͌^̑Î݂ɗp邽߁C̃|C^œn
+	const bool _is_warm_start = !cmd.getParameter("initial_tour_dir_path").empty();
+	const auto _dispatch_search = [_is_warm_start](auto __types, auto&& __function) {
+		using types = decltype(__types);
+		if (_is_warm_start) {
+			return __function(__types, static_cast<typename types::warm_start_search*>(nullptr));
+		}
+		else {
+			return __function(__types, static_cast<typename types::search*>(nullptr));
+		}
+	};
+
+	//_T̍ő僁ʂς
+	//͓ǂݍ܂C_Ot̃ʂςCTNXȂǂresizeĎۂ̊mۗʂ𐔂
+	//s̓̕XPW[蓖Ăő̃XbhŌς
+	const auto _estimate_peak_size = [&](auto __types, auto* __search, const std::size_t __dimension, std::ostream& __os) {
+		using types = decltype(__types);
+		using search_type = std::remove_pointer_t<decltype(__search)>;
+		search_type _search;
+		typename types::search_info_type _search_info;
+		typename types::solution_type _solution;
+		_search.resize(static_cast<typename search_type::size_type>(__dimension));
+		_search_info.resize(static_cast<typename types::search_info_type::size_type>(__dimension));
+		_solution.resize(static_cast<typename types::solution_type::size_type>(__dimension));
+		return okl::writeMemorySize(__os, std::stoul(cmd.getParameter("trial_num").c_str()), std::stoul(cmd.getParameter("thread_num").c_str()),
+			okl::problem::estimateMemorySize<typename types::graph_type>(__dimension), _search, _search_info, _solution);
+	};
+
+	if (std::stoul(cmd.getParameter("dry_run").c_str()) != 0) {
+		std::size_t _max_peak_size = 0;
+		for (const auto& _instance : _instances) {
+			const auto _path = _instances_dir_path + _instance.name() + _extension;
+			const auto _dimension = okl::problem::loadDimension(_path);
+			if (_dimension == 0) {
+				std::cerr << _path << ": _ǂݍ߂܂" << std::endl;
+				continue;
+			}
+			_max_peak_size = std::max(_max_peak_size, okl::problem::dispatchTypes(_dimension, [&](auto __types) {
+				std::cout << _instance.name() << "\t_:" << _dimension << "\t_ID[bit]:" << 8 * sizeof(typename decltype(__types)::id_type) << std::endl;
+				return _dispatch_search(__types, [&](auto __types, auto* __search) {
+					return _estimate_peak_size(__types, __search, _dimension, std::cout);
+				});
+			}));
+		}
+		std::cout << "ႲƂ̍ő僁[MB]:" << (_max_peak_size + 1024 * 1024 - 1) / (1024 * 1024) << std::endl;
+		return 0;
+	}
+
+	//ႲƂ̓ǂݍݏƒTo^C͈͓̔œɎs
+	//̖̓ǂݍ݂͒TɃobNOEhŐɍs
+	if (!cmd.getParameter("chrome_trace_path").empty()) {
+#ifdef OKL_TRACE
+		okl::ChromeTrace::open(cmd.getParameter("chrome_trace_path"), std::stoul(cmd.getParameter("chrome_trace_trial_interval").c_str()),
+			static_cast<std::uint_least64_t>(std::stod(cmd.getParameter("chrome_trace_min_duration").c_str()) * 1000), std::stoul(cmd.getParameter("chrome_trace_max_events").c_str()));
+#else
+		std::cerr << "chrome_trace_path is ignored: build with -DOKL_TRACE" << std::endl;
+#endif
+	}
+
+	okl::BatchScheduler _scheduler;
+	_scheduler.setPrefetchNum(std::stoul(cmd.getParameter("prefetch_num").c_str()));
 	for (const auto& _instance : _instances) {
-		okl::problem::search _search;
-		okl::problem::graph_type _graph;
-		okl::problem::search_info_type _search_info;
-		okl::problem::solution_type _solution;
-		okl::problem::load(_instances_dir_path + _instance.name() + _extension, _instance, _graph, _search_info, _solution);
-		_search.resize(static_cast<okl::problem::search::size_type>(_graph.vertices().size()));
-
-		std::cout << _instance;
-		std::cout << _graph;
-		std::cout << okl::format(okl::problem::search::info()) << std::endl;
-		
-		_search_info.setBestKnownCost(_instance.best_known_cost());
-		_search_info.setRepeatTimes(std::stoul(cmd.getParameter("repeat_times").c_str()));
-		_search_info.setRunTime(std::stod(cmd.getParameter("run_time").c_str()));
-		_search_info.setResultOutputPath(cmd.getParameter("results_dir_path") + _instance.name());
-		_search_info.setLogOutputPath(cmd.getParameter("log_dir_path") + _instance.name());
-		_search_info.setPopSize(std::stoul(cmd.getParameter("pop_size").c_str()));
-		
-		okl::run(std::stoul(cmd.getParameter("trial_num").c_str()), _instance.initial_seed(), _graph, _search, _search_info, _solution);
+		const auto _path = _instances_dir_path + _instance.name() + _extension;
+		const auto _dimension = okl::problem::loadDimension(_path);
+		if (_dimension == 0) {
+			std::cerr << _path << ": _ǂݍ߂Ȃ߁C̖΂܂" << std::endl;
+			continue;
+		}
+		//_ɍ_ID^̌^ꎮŒT
+		okl::problem::dispatchTypes(_dimension, [&](auto __types) {
+			_dispatch_search(__types, [&](auto __types, auto* __search) {
+				using types = decltype(__types);
+				using search_type = std::remove_pointer_t<decltype(__search)>;
+				const auto _problem = std::make_shared<std::tuple<search_type, typename types::graph_type, typename types::search_info_type, typename types::solution_type>>();
+				std::ostream _null_stream(nullptr);
+				_scheduler.addJob(_estimate_peak_size(__types, __search, _dimension, _null_stream), _dimension * _dimension,
+					[&_instance, _path, _problem]() {
+						auto& [_search, _graph, _search_info, _solution] = *_problem;
+						okl::problem::load(_path, _instance, _graph, _search_info, _solution);
+						_search.resize(static_cast<typename search_type::size_type>(_graph.vertices().size()));
+					},
+					[&, _problem](const std::size_t __thread_num) {
+						auto& [_search, _graph, _search_info, _solution] = *_problem;
+
+						{
+							std::lock_guard<std::mutex> _lock(okl::BatchScheduler::output_mutex());
+							std::cout << _instance;
+							std::cout << _graph;
+							std::cout << okl::format(search_type::info()) << std::endl;
+							okl::writeMemorySize(std::cout, std::stoul(cmd.getParameter("trial_num").c_str()), __thread_num, sizeof(_graph) + okl::memorySize(_graph), _search, _search_info, _solution);
+							if (okl::HugePage::mode() != okl::HugePage::none) {
+								std::cout << "q[Wy[W[byte]\t" << okl::HugePage::bytes() << std::endl;
+							}
+						}
+
+						_search_info.setBestKnownCost(_instance.best_known_cost());
+						_search_info.setRepeatTimes(std::stoul(cmd.getParameter("repeat_times").c_str()));
+						_search_info.setRunTime(std::stod(cmd.getParameter("run_time").c_str()));
+						_search_info.setTimeCheckInterval(std::stoul(cmd.getParameter("time_check_interval").c_str()));
+
+						//`FbN|CgĊJꍇCo̓t@C͕ۑ̃TCYɐ؂l߂ĒǋL
+						okl::Checkpoint _checkpoint;
+						bool _is_resumed = false;
+						if (!cmd.getParameter("checkpoint_dir_path").empty()) {
+							_checkpoint.setPath(cmd.getParameter("checkpoint_dir_path") + _instance.name() + ".ckpt", std::stoul(cmd.getParameter("checkpoint_interval").c_str()));
+							if (std::stoul(cmd.getParameter("resume").c_str()) != 0 && _checkpoint.load(std::stoul(cmd.getParameter("trial_num").c_str()), _instance.initial_seed())) {
+								_search_info.resumeOutput(_checkpoint.output_sizes());
+								_is_resumed = true;
+							}
+						}
+
+						_search_info.setResultOutputPath(cmd.getParameter("results_dir_path") + _instance.name());
+						_search_info.setTraceChunkSize(std::stoul(cmd.getParameter("trace_chunk_size").c_str()));
+						_search_info.setPerfCounterEnabled(std::stoul(cmd.getParameter("perf_counter").c_str()) != 0);
+						_search_info.setLogOutputPath(cmd.getParameter("log_dir_path") + _instance.name());
+						if (!cmd.getParameter("tour_dir_path").empty()) {
+							_search_info.setSolutionOutputPath(cmd.getParameter("tour_dir_path") + _instance.name());
+						}
+						if (!cmd.getParameter("initial_tour_dir_path").empty()) {
+							_search_info.setInitialSolutionPath(cmd.getParameter("initial_tour_dir_path") + _instance.name() + ".tour");
+						}
+						if (!cmd.getParameter("improvement_dir_path").empty()) {
+							auto _improvement_stream = std::make_shared<okl::ImprovementStream<okl::problem::cost_type, okl::problem::cost_comparison_function>>();
+							const auto _improvement_path = cmd.getParameter("improvement_dir_path") + _instance.name() + "_improvement_.jsonl";
+							const bool _is_solution_required = std::stoul(cmd.getParameter("improvement_solution").c_str()) != 0;
+							//PCxg̏o̓t@CTCY̓`FbN|Cg̏o̓t@CTCY̖ɂ Â`FbN|CgŃTCYȂΒǋL
+							constexpr auto _improvement_channel = std::tuple_size<typename types::search_info_type::output_buffer_type>::value;
+							if (_is_resumed && _improvement_channel < _checkpoint.output_sizes().size()) {
+								_improvement_stream->resume(_improvement_path, _instance.name(), _is_solution_required, _checkpoint.output_sizes()[_improvement_channel]);
+							}
+							else {
+								_improvement_stream->open(_improvement_path, _instance.name(), _is_solution_required, _is_resumed ? std::ios_base::out | std::ios_base::app : std::ios_base::out);
+							}
+							_search_info.setImprovementSubscriber(_improvement_stream);
+						}
+						_search_info.setPopSize(std::stoul(cmd.getParameter("pop_size").c_str()));
+						//sĉ̐iȂ悤Cᖼt̍sŏo͂
+						_search_info.setProgressName(_instance.name());
+
+						okl::run(std::stoul(cmd.getParameter("trial_num").c_str()), __thread_num, _instance.initial_seed(), _graph, _search, _search_info, _solution, _checkpoint);
+					});
+			});
+		});
 	}
+	_scheduler.run(std::stoul(cmd.getParameter("thread_num").c_str()), static_cast<std::size_t>(std::stoull(cmd.getParameter("memory_budget").c_str())) * 1024 * 1024);
+	okl::ChromeTrace::close();
 }
\ No newline at end of file
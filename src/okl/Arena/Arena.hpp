@@ -0,0 +1,153 @@
+﻿#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace okl {
+	/*!
+	 *  @brief      連続領域クラス
+	 *  @details    同じ大きさのブロックを並べた1つの連続領域を確保する
+	 *				各ブロックの先頭はキャッシュライン境界に揃える
+	 *				母集団の個体の巡回路などをまとめて格納し，集団全体の走査を連続したメモリアクセスにするために用いる
+	 *				- __Value				要素型 複製をmemcpyで行うためtrivially copyableであること
+	 *				- __Alignment			ブロックの境界[byte]
+	 */
+	template<
+		typename __Value,
+		std::size_t __Alignment = 64>
+		class Arena
+	{
+		static_assert(std::is_trivially_copyable_v<__Value>, "Arena requires a trivially copyable value type");
+		static_assert(__Alignment % alignof(__Value) == 0, "Arena alignment must be a multiple of the value alignment");
+
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		Arena() : data_(nullptr), block_num_(0), block_size_(0), block_stride_(0) {}
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 * @detail				同じ形の領域を確保し，内容を複製する
+		 */
+		Arena(const Arena& __other) : Arena()
+		{
+			this->resize(__other.block_num_, __other.block_size_);
+			if (this->data_ != nullptr) {
+				std::memcpy(this->data_, __other.data_, this->bytes());
+			}
+		}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~Arena()
+		{
+			this->release();
+		}
+
+		using value_type = __Value;
+		using size_type = std::size_t;
+
+		/*!
+		 * @brief			代入処理
+		 */
+		Arena& operator=(const Arena&) = delete;
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__block_num ブロック数
+		 * @param[in]		__block_size ブロックごとの要素数
+		 * @detail			形が変わる場合のみ領域を確保し直す 確保し直した場合，以前のブロックへのポインタは無効になる
+		 */
+		void resize(const size_type __block_num, const size_type __block_size)
+		{
+			if (__block_num == this->block_num_ && __block_size == this->block_size_) {
+				return;
+			}
+			this->release();
+			this->block_num_ = __block_num;
+			this->block_size_ = __block_size;
+			//ブロックの先頭がキャッシュライン境界になるように要素数を切り上げる
+			const auto _block_bytes = (__block_size * sizeof(value_type) + __Alignment - 1) / __Alignment * __Alignment;
+			this->block_stride_ = _block_bytes / sizeof(value_type);
+			if (0 < this->bytes()) {
+				this->data_ = static_cast<value_type*>(::operator new(this->bytes(), std::align_val_t(__Alignment)));
+			}
+		}
+
+		/*!
+		 * @brief			ブロックの先頭を返す
+		 * @param[in]		__index ブロック番号
+		 * @return			value_type*	ブロックの先頭要素のポインタを返す
+		 */
+		inline value_type* block(const size_type __index)
+		{
+			assert(__index < this->block_num_);
+			return this->data_ + __index * this->block_stride_;
+		}
+
+		/*!
+		 * @brief			ブロック数を返す
+		 * @return			size_type	ブロック数を返す
+		 */
+		constexpr size_type block_num() const
+		{
+			return this->block_num_;
+		}
+
+		/*!
+		 * @brief			ブロックごとの要素数を返す
+		 * @return			size_type	ブロックごとに格納できる要素数を返す
+		 */
+		constexpr size_type block_size() const
+		{
+			return this->block_size_;
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	連続領域の大きさ[byte]を返す
+		 */
+		constexpr std::size_t memory_size() const
+		{
+			return this->bytes();
+		}
+
+	private:
+		//!連続領域の先頭
+		value_type* data_;
+
+		//!ブロック数
+		size_type block_num_;
+
+		//!ブロックごとの要素数
+		size_type block_size_;
+
+		//!ブロックの先頭の間隔[要素数]
+		size_type block_stride_;
+
+		/*!
+		 * @brief			連続領域の大きさを返す
+		 * @return			std::size_t	連続領域の大きさ[byte]を返す
+		 */
+		constexpr std::size_t bytes() const
+		{
+			return this->block_num_ * this->block_stride_ * sizeof(value_type);
+		}
+
+		/*!
+		 * @brief			連続領域を解放する
+		 */
+		inline void release()
+		{
+			if (this->data_ != nullptr) {
+				::operator delete(this->data_, std::align_val_t(__Alignment));
+				this->data_ = nullptr;
+			}
+		}
+	};
+} /* namespace okl */
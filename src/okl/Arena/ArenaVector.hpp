@@ -0,0 +1,294 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace okl {
+	/*!
+	 *  @brief      連続領域対応可変長配列クラス
+	 *  @details    Arenaのブロックに結び付けて要素を格納できる可変長配列クラス
+	 *				結び付けていない間は自身でヒープ領域を確保するため，std::vectorの代わりに解クラスの配列型として用いる
+	 *				結び付けている配列への代入は，要素数がブロックに収まる限りブロック内に複製し，結び付けを保つ
+	 *				結び付けている配列の交換は要素を交換するため，ブロックは入れ替わらない
+	 *				- __Value				要素型
+	 */
+	template<typename __Value>
+	class ArenaVector
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ArenaVector() : data_(nullptr), size_(0), capacity_(0) {}
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 * @detail				結び付けずに自身の領域に複製する
+		 */
+		ArenaVector(const ArenaVector& __other) : ArenaVector()
+		{
+			this->allocate(__other.size_);
+			std::copy(__other.begin(), __other.end(), this->data_);
+			this->size_ = __other.size_;
+		}
+
+		/*!
+		 * @brief				ムーブコンストラクタ
+		 * @detail				領域を引き継ぐ 結び付けている場合は結び付けも引き継ぐ
+		 */
+		ArenaVector(ArenaVector&& __other) noexcept
+			: data_(std::exchange(__other.data_, nullptr)), size_(std::exchange(__other.size_, 0)), capacity_(std::exchange(__other.capacity_, 0)), owned_(std::move(__other.owned_)) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ArenaVector() = default;
+
+		using value_type = __Value;
+		using size_type = std::size_t;
+		using iterator = value_type*;
+		using const_iterator = const value_type*;
+
+		/*!
+		 * @brief			代入処理を行う
+		 * @param[in]		__other 代入元対象
+		 * @return			ArenaVector&	自分自身の参照を返す
+		 * @detail			要素数が領域に収まるなら領域を確保し直さずに複製する
+		 */
+		ArenaVector& operator=(const ArenaVector& __other)
+		{
+			if (this != &__other) {
+				if (this->capacity_ < __other.size_) {
+					this->allocate(__other.size_);
+				}
+				std::copy(__other.begin(), __other.end(), this->data_);
+				this->size_ = __other.size_;
+			}
+			return *this;
+		}
+
+		/*!
+		 * @brief			ムーブ代入処理を行う
+		 * @param[in]		__other 代入元対象
+		 * @return			ArenaVector&	自分自身の参照を返す
+		 * @detail			結び付けている場合と代入元が結び付けている場合は複製し，それ以外は領域を引き継ぐ
+		 */
+		ArenaVector& operator=(ArenaVector&& __other) noexcept
+		{
+			if (this->isBound() || __other.isBound()) {
+				return *this = static_cast<const ArenaVector&>(__other);
+			}
+			this->data_ = std::exchange(__other.data_, nullptr);
+			this->size_ = std::exchange(__other.size_, 0);
+			this->capacity_ = std::exchange(__other.capacity_, 0);
+			this->owned_ = std::move(__other.owned_);
+			return *this;
+		}
+
+		/*!
+		 * @brief			ブロックに結び付ける
+		 * @param[in]		__data ブロックの先頭 nullptrなら結び付けを解除する
+		 * @param[in]		__capacity ブロックに格納できる要素数
+		 * @detail			格納中の要素をブロックに移し，自身の領域は解放する
+		 *					結び付けを解除する場合は，格納中の要素を自身で確保した領域に移す
+		 */
+		void bind(value_type* __data, const size_type __capacity)
+		{
+			if (__data == nullptr) {
+				this->allocate(this->size_);
+				return;
+			}
+			assert(this->size_ <= __capacity);
+			if (__data != this->data_) {
+				std::copy(this->begin(), this->end(), __data);
+			}
+			this->owned_.reset();
+			this->data_ = __data;
+			this->capacity_ = __capacity;
+		}
+
+		/*!
+		 * @brief			ブロックに結び付けているか判定する
+		 * @return			bool	結び付けているならTrue
+		 */
+		inline bool isBound() const
+		{
+			return this->data_ != nullptr && !this->owned_;
+		}
+
+		/*!
+		 * @brief			要素数を設定する
+		 * @param[in]		__size 要素数
+		 * @param[in]		__value 増えた要素の値
+		 * @detail			結び付けている場合はブロックに収まる要素数であること
+		 */
+		void resize(const size_type __size, const value_type& __value = value_type())
+		{
+			if (this->capacity_ < __size) {
+				assert(!this->isBound());
+				this->allocate(__size);
+			}
+			if (this->size_ < __size) {
+				std::fill(this->data_ + this->size_, this->data_ + __size, __value);
+			}
+			this->size_ = __size;
+		}
+
+		/*!
+		 * @brief			要素を交換する
+		 * @param[in,out]	__other 交換対象
+		 * @detail			どちらも結び付けていなければ領域を交換し，そうでなければ要素を交換する
+		 */
+		void swap(ArenaVector& __other)
+		{
+			if (!this->isBound() && !__other.isBound()) {
+				std::swap(this->data_, __other.data_);
+				std::swap(this->size_, __other.size_);
+				std::swap(this->capacity_, __other.capacity_);
+				std::swap(this->owned_, __other.owned_);
+			}
+			else if (this->size_ == __other.size_) {
+				std::swap_ranges(this->begin(), this->end(), __other.begin());
+			}
+			else {
+				ArenaVector _temporary(*this);
+				*this = __other;
+				__other = _temporary;
+			}
+		}
+
+		/*!
+		 * @brief			先頭イテレータを返す
+		 * @return			iterator	先頭イテレータを返す
+		 */
+		constexpr iterator begin()
+		{
+			return this->data_;
+		}
+
+		/*!
+		 * @brief			末尾の次のイテレータを返す
+		 * @return			iterator	末尾の次のイテレータを返す
+		 */
+		constexpr iterator end()
+		{
+			return this->data_ + this->size_;
+		}
+
+		/*!
+		 * @brief			読み取り専用先頭イテレータを返す
+		 * @return			const_iterator	読み取り専用先頭イテレータを返す
+		 */
+		constexpr const_iterator begin() const
+		{
+			return this->data_;
+		}
+
+		/*!
+		 * @brief			読み取り専用末尾の次のイテレータを返す
+		 * @return			const_iterator	読み取り専用末尾の次のイテレータを返す
+		 */
+		constexpr const_iterator end() const
+		{
+			return this->data_ + this->size_;
+		}
+
+		/*!
+		 * @brief			要素の先頭を返す
+		 * @return			value_type*	要素の先頭のポインタを返す
+		 */
+		constexpr value_type* data()
+		{
+			return this->data_;
+		}
+
+		/*!
+		 * @brief			要素の先頭を返す
+		 * @return			const value_type*	読み取り専用の要素の先頭のポインタを返す
+		 */
+		constexpr const value_type* data() const
+		{
+			return this->data_;
+		}
+
+		/*!
+		 * @brief			要素数を返す
+		 * @return			size_type	要素数を返す
+		 */
+		constexpr size_type size() const
+		{
+			return this->size_;
+		}
+
+		/*!
+		 * @brief			格納できる要素数を返す
+		 * @return			size_type	領域を確保し直さずに格納できる要素数を返す
+		 */
+		constexpr size_type capacity() const
+		{
+			return this->capacity_;
+		}
+
+		/*!
+		 * @brief			指定のインデックスの要素を返す
+		 * @param[in]		__index インデックス
+		 * @return			value_type&	要素の参照を返す
+		 */
+		inline value_type& operator[](const size_type __index)
+		{
+			assert(__index < this->size_);
+			return this->data_[__index];
+		}
+
+		/*!
+		 * @brief			指定のインデックスの要素を返す
+		 * @param[in]		__index インデックス
+		 * @return			value_type&	要素の参照を返す
+		 */
+		inline const value_type& operator[](const size_type __index) const
+		{
+			assert(__index < this->size_);
+			return this->data_[__index];
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	自身で確保しているヒープ領域[byte]を返す 結び付けているブロックは含まない
+		 */
+		inline std::size_t memory_size() const
+		{
+			return this->owned_ ? this->capacity_ * sizeof(value_type) : 0;
+		}
+
+	private:
+		//!要素の先頭
+		value_type* data_;
+
+		//!要素数
+		size_type size_;
+
+		//!格納できる要素数
+		size_type capacity_;
+
+		//!自身で確保した領域 結び付けている間は空
+		std::unique_ptr<value_type[]> owned_;
+
+		/*!
+		 * @brief			自身の領域を確保し直す
+		 * @param[in]		__capacity 格納できる要素数
+		 * @detail			格納中の要素は新しい領域に移す 結び付けは解除される
+		 */
+		void allocate(const size_type __capacity)
+		{
+			auto _owned = std::make_unique<value_type[]>(__capacity);
+			std::copy(this->begin(), this->begin() + std::min(this->size_, __capacity), _owned.get());
+			this->owned_ = std::move(_owned);
+			this->data_ = this->owned_.get();
+			this->capacity_ = __capacity;
+			this->size_ = std::min(this->size_, __capacity);
+		}
+	};
+} /* namespace okl */
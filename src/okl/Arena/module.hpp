@@ -0,0 +1,3 @@
+﻿#pragma once
+#include "Arena.hpp"
+#include "ArenaVector.hpp"
\ No newline at end of file
@@ -0,0 +1,363 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      非同期ファイル書き込みクラス
+	 *  @details    複数のファイルへの書き込みを1つのバックグラウンドスレッドで行う
+	 *				書き込み要求は文字列としてキューに積むだけなので，呼び出し元のスレッドは書き込みを待たない
+	 *				ファイルは大きなバッファで書き込み，flush関数，sync関数かclose関数が呼ばれたときのみフラッシュする
+	 *				ファイルは番号(チャンネル)で指定し，要求は呼び出し順に処理される
+	 *				バックグラウンドスレッドは最初の要求時に開始する
+	 *				未処理の書き込み要求の合計サイズが上限に達したら，書き込みが追い付くまで呼び出し元のスレッドを待たせる
+	 *				書き込みバッファはチャンネルごとに1つだけ確保し，同じチャンネルでファイルを開き直しても使い回す
+	 */
+	class AsyncWriter
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 * @param[in]			__buffer_size ファイルごとの書き込みバッファサイズ[byte]
+		 * @param[in]			__max_queued_size 未処理の書き込み要求の合計サイズの上限[byte]
+		 */
+		explicit AsyncWriter(const std::size_t __buffer_size = 1 << 20, const std::size_t __max_queued_size = 1 << 26) :
+			buffer_size_(__buffer_size), max_queued_size_(__max_queued_size), queued_size_(0), pushed_num_(0), processed_num_(0), is_closing_(false) {}
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 */
+		AsyncWriter(const AsyncWriter&) = delete;
+
+		/*!
+		 * @brief				デストラクタ
+		 * @detail				未処理の要求を全て書き込んでからファイルを閉じる
+		 */
+		virtual ~AsyncWriter()
+		{
+			this->close();
+		}
+
+		using size_type = std::size_t;
+
+		/*!
+		 * @brief			代入処理
+		 */
+		AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+		/*!
+		 * @brief			ファイルを開く
+		 * @param[in]		__channel チャンネル番号
+		 * @param[in]		__path ファイルパス
+		 * @param[in]		__mode 開くモード
+		 * @detail			チャンネルで開いているファイルがあれば閉じてから開く
+		 */
+		inline void open(const size_type __channel, const std::string& __path, const std::ios_base::openmode __mode = std::ios_base::out)
+		{
+			this->setPath(__channel, __path);
+			this->push({ Command::OPEN, __channel, __path, __mode, 0 });
+		}
+
+		/*!
+		 * @brief			ファイルを指定サイズから追記するように開く
+		 * @param[in]		__channel チャンネル番号
+		 * @param[in]		__path ファイルパス
+		 * @param[in]		__size ファイルサイズ[byte]
+		 * @detail			ファイルが__sizeより大きければ__sizeに切り詰めてから追記モードで開く
+		 *					チェックポイントから再開する際，チェックポイント以降に書き込まれた内容を捨てるために用いる
+		 */
+		inline void resume(const size_type __channel, const std::string& __path, const std::uintmax_t __size)
+		{
+			this->setPath(__channel, __path);
+			this->push({ Command::RESUME, __channel, __path, std::ios_base::out | std::ios_base::app, __size });
+		}
+
+		/*!
+		 * @brief			ファイルに書き込む
+		 * @param[in]		__channel チャンネル番号
+		 * @param[in]		__data 書き込む文字列
+		 * @detail			書き込みを要求し，書き込みを待たずに戻る
+		 *					未処理の書き込み要求が上限に達していれば，バックグラウンドスレッドが処理するまで待つ
+		 */
+		inline void write(const size_type __channel, std::string __data)
+		{
+			if (!__data.empty()) {
+				this->push({ Command::WRITE, __channel, std::move(__data), std::ios_base::out, 0 });
+			}
+		}
+
+		/*!
+		 * @brief			全てのファイルをフラッシュする
+		 * @detail			それまでの書き込みのフラッシュを要求し，フラッシュを待たずに戻る
+		 */
+		inline void flush()
+		{
+			this->push({ Command::FLUSH, 0, std::string(), std::ios_base::out, 0 });
+		}
+
+		/*!
+		 * @brief			全てのファイルをフラッシュし完了を待つ
+		 * @detail			それまでの要求を全て処理し，フラッシュが完了するまで待つ
+		 *					戻った後はsize関数でファイルサイズを取得できる
+		 */
+		void sync()
+		{
+			this->flush();
+			std::unique_lock<std::mutex> _lock(this->mutex_);
+			const auto _pushed_num = this->pushed_num_;
+			this->processed_condition_.wait(_lock, [this, _pushed_num]() { return _pushed_num <= this->processed_num_; });
+		}
+
+		/*!
+		 * @brief			ファイルサイズを返す
+		 * @param[in]		__channel チャンネル番号
+		 * @return			std::uintmax_t	ファイルサイズ[byte]を返す 開いていなければ0を返す
+		 * @detail			sync関数の後に呼び出す
+		 */
+		std::uintmax_t size(const size_type __channel) const
+		{
+			if (this->paths_.size() <= __channel || this->paths_[__channel].empty()) {
+				return 0;
+			}
+			std::error_code _error;
+			const auto _size = std::filesystem::file_size(this->paths_[__channel], _error);
+			return _error ? 0 : _size;
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	開いたファイルの書き込みバッファの合計[byte]を返す
+		 * @detail			キューに積まれた未処理の書き込み要求は含まない 未処理の書き込み要求は上限サイズまでに抑えられる
+		 */
+		std::size_t memory_size() const
+		{
+			return this->buffer_size_ * static_cast<std::size_t>(std::count_if(this->paths_.begin(), this->paths_.end(),
+				[](const auto& _path) { return !_path.empty(); }));
+		}
+
+		/*!
+		 * @brief			全てのファイルを閉じる
+		 * @detail			未処理の要求を全て書き込み，全てのファイルを閉じるまで待つ
+		 *					バックグラウンドスレッドは終了し，次の要求時に再度開始する
+		 */
+		void close()
+		{
+			{
+				std::lock_guard<std::mutex> _lock(this->mutex_);
+				if (!this->thread_.joinable()) {
+					return;
+				}
+				this->is_closing_ = true;
+			}
+			this->condition_.notify_one();
+			this->thread_.join();
+			this->is_closing_ = false;
+		}
+
+	private:
+		/*!
+		 * @brief      書き込み要求
+		 */
+		struct Command {
+			//!ファイルを開く要求
+			static constexpr int OPEN = 0;
+			//!書き込み要求
+			static constexpr int WRITE = 1;
+			//!フラッシュ要求
+			static constexpr int FLUSH = 2;
+			//!切り詰めて追記する要求
+			static constexpr int RESUME = 3;
+			//!要求の種類
+			int type_;
+			//!チャンネル番号
+			size_type channel_;
+			//!ファイルパスまたは書き込む文字列
+			std::string data_;
+			//!開くモード
+			std::ios_base::openmode mode_;
+			//!切り詰めるファイルサイズ
+			std::uintmax_t size_;
+		};
+
+		/*!
+		 * @brief      チャンネルごとのファイル
+		 */
+		struct File {
+			//!出力ストリーム
+			std::ofstream out_;
+			//!書き込みバッファ
+			std::vector<char> buffer_;
+		};
+
+		//!ファイルごとの書き込みバッファサイズ
+		size_type buffer_size_;
+
+		//!未処理の書き込み要求の合計サイズの上限
+		size_type max_queued_size_;
+
+		//!未処理の書き込み要求の合計サイズ
+		size_type queued_size_;
+
+		//!未処理の要求
+		std::vector<Command> commands_;
+
+		//!チャンネルごとのファイル バックグラウンドスレッドのみが操作する
+		std::vector<std::unique_ptr<File>> files_;
+
+		//!チャンネルごとのファイルパス 呼び出し元のスレッドのみが操作する
+		std::vector<std::string> paths_;
+
+		//!要求した数
+		std::size_t pushed_num_;
+
+		//!処理した要求の数
+		std::size_t processed_num_;
+
+		//!要求の排他制御
+		std::mutex mutex_;
+
+		//!要求の通知
+		std::condition_variable condition_;
+
+		//!要求の処理完了の通知
+		std::condition_variable processed_condition_;
+
+		//!バックグラウンドスレッド
+		std::thread thread_;
+
+		//!終了要求
+		bool is_closing_;
+
+		/*!
+		 * @brief			要求をキューに積む
+		 * @param[in]		__command 要求
+		 */
+		inline void push(Command&& __command)
+		{
+			{
+				std::unique_lock<std::mutex> _lock(this->mutex_);
+				//未処理の要求があれば，バックグラウンドスレッドは開始済み
+				this->processed_condition_.wait(_lock, [this]() { return this->queued_size_ < this->max_queued_size_; });
+				if (__command.type_ == Command::WRITE) {
+					this->queued_size_ += __command.data_.size();
+				}
+				this->commands_.push_back(std::move(__command));
+				++this->pushed_num_;
+				if (!this->thread_.joinable()) {
+					this->thread_ = std::thread(&AsyncWriter::process, this);
+				}
+			}
+			this->condition_.notify_one();
+		}
+
+		/*!
+		 * @brief			チャンネルのファイルパスを記録する
+		 * @param[in]		__channel チャンネル番号
+		 * @param[in]		__path ファイルパス
+		 */
+		inline void setPath(const size_type __channel, const std::string& __path)
+		{
+			if (this->paths_.size() <= __channel) {
+				this->paths_.resize(__channel + 1);
+			}
+			this->paths_[__channel] = __path;
+		}
+
+		/*!
+		 * @brief			バックグラウンドスレッドの処理
+		 * @detail			終了要求があるまで要求をまとめて取り出して処理する
+		 */
+		void process()
+		{
+			std::vector<Command> _commands;
+			while (true)
+			{
+				size_type _processed_size = 0;
+				bool _is_closing;
+				{
+					std::unique_lock<std::mutex> _lock(this->mutex_);
+					this->condition_.wait(_lock, [this]() { return !this->commands_.empty() || this->is_closing_; });
+					_commands.swap(this->commands_);
+					_is_closing = this->is_closing_;
+				}
+
+				for (auto& _command : _commands) {
+					this->execute(_command);
+					if (_command.type_ == Command::WRITE) {
+						_processed_size += _command.data_.size();
+					}
+				}
+
+				{
+					std::lock_guard<std::mutex> _lock(this->mutex_);
+					this->processed_num_ += _commands.size();
+					this->queued_size_ -= _processed_size;
+					this->processed_condition_.notify_all();
+					if (_is_closing && this->commands_.empty()) {
+						break;
+					}
+				}
+				_commands.clear();
+			}
+			for (auto& _file : this->files_) {
+				if (_file) {
+					_file->out_.close();
+				}
+			}
+		}
+
+		/*!
+		 * @brief			要求を処理する
+		 * @param[in]		__command 要求
+		 */
+		void execute(Command& __command)
+		{
+			if (__command.type_ == Command::FLUSH) {
+				for (auto& _file : this->files_) {
+					if (_file && _file->out_.is_open()) {
+						_file->out_.flush();
+					}
+				}
+				return;
+			}
+
+			if (this->files_.size() <= __command.channel_) {
+				this->files_.resize(__command.channel_ + 1);
+			}
+			auto& _file = this->files_[__command.channel_];
+			if (__command.type_ == Command::OPEN || __command.type_ == Command::RESUME) {
+				if (__command.type_ == Command::RESUME) {
+					std::error_code _error;
+					if (std::filesystem::exists(__command.data_, _error) && __command.size_ < std::filesystem::file_size(__command.data_, _error)) {
+						std::filesystem::resize_file(__command.data_, __command.size_, _error);
+					}
+				}
+				//開いているファイルは閉じて，バッファは使い回す
+				if (_file) {
+					_file->out_.close();
+					_file->out_.clear();
+				}
+				else {
+					_file = std::make_unique<File>();
+					_file->buffer_.resize(this->buffer_size_);
+				}
+				//バッファは開く前に設定する
+				_file->out_.rdbuf()->pubsetbuf(_file->buffer_.data(), static_cast<std::streamsize>(_file->buffer_.size()));
+				_file->out_.open(__command.data_, __command.mode_);
+			}
+			else if (_file && _file->out_.is_open()) {
+				_file->out_.write(__command.data_.data(), static_cast<std::streamsize>(__command.data_.size()));
+			}
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "AsyncWriter.hpp"
\ No newline at end of file
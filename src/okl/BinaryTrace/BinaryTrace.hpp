@@ -0,0 +1,334 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../MemorySize/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      バイナリ時系列トレースクラス
+	 *  @details    時系列データを列ごとのバイナリ形式に変換する
+	 *				行はチャンク単位でまとめ，チャンクが埋まるごとにバイト列に変換する
+	 *				列の格納領域はresize関数で事前に確保するため，行の追加でメモリ確保を行わない
+	 *				- __Tuple				1行のデータ型 std::tuple 要素は算術型
+	 *
+	 *				形式(値はすべて書き込んだ環境のバイト順)
+	 *				- ヘッダー				"OKLT", 版数(1byte), 列数(1byte), 列ごとに種類(1byte 0:符号なし整数 1:符号付き整数 2:浮動小数点)とサイズ(1byte)
+	 *				- チャンク				行数(4byte), 列ごとに行数分の値
+	 *				- 試行終端				行数0のチャンク
+	 */
+	template<
+		class __Tuple>
+		class BinaryTrace
+	{
+		/*!
+		 * @brief			列ごとの格納領域の型を求める
+		 * @detail			宣言のみ decltypeで用いる
+		 */
+		template<class... __Values>
+		static std::tuple<std::vector<__Values>...> makeColumns(const std::tuple<__Values...>&);
+
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		BinaryTrace() : chunk_size_(0), size_(0) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~BinaryTrace() = default;
+
+		using tuple_type = __Tuple;
+		using size_type = std::uint32_t;
+		using columns_type = decltype(makeColumns(std::declval<tuple_type>()));
+
+		//!列数
+		static constexpr std::size_t column_num = std::tuple_size<tuple_type>::value;
+
+		/*!
+		 * @brief			全要素初期化
+		 * @detail			格納中の行と変換済みのバイト列を削除する
+		 *					メモリ解放は行わない
+		 */
+		inline void clear()
+		{
+			this->size_ = 0;
+			this->data_.clear();
+		}
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__chunk_size チャンクの行数
+		 * @detail			列の格納領域を確保する
+		 */
+		inline void resize(const size_type __chunk_size)
+		{
+			this->clear();
+			this->chunk_size_ = __chunk_size;
+			std::apply([__chunk_size](auto&... __columns) { (__columns.resize(__chunk_size), ...); }, this->columns_);
+		}
+
+		/*!
+		 * @brief			チャンクの行数を返す
+		 * @return			size_type	チャンクの行数を返す
+		 */
+		inline size_type chunk_size() const
+		{
+			return this->chunk_size_;
+		}
+
+		/*!
+		 * @brief			行を追加する
+		 * @param[in]		__row 行
+		 * @detail			チャンクが埋まったらバイト列に変換する
+		 */
+		inline void push(const tuple_type& __row)
+		{
+			this->set(__row, std::make_index_sequence<column_num>());
+			if (++this->size_ == this->chunk_size_) {
+				this->encodeChunk();
+			}
+		}
+
+		/*!
+		 * @brief			別のトレースの行を追加する
+		 * @param[in]		__other 追加元
+		 * @detail			追加元の変換済みのバイト列と格納中の行を順に追加する
+		 */
+		inline void append(const BinaryTrace& __other)
+		{
+			this->encodeChunk();
+			this->data_.append(__other.data_);
+			for (size_type _row = 0; _row < __other.size_; ++_row) {
+				this->push(__other.row(_row, std::make_index_sequence<column_num>()));
+			}
+		}
+
+		/*!
+		 * @brief			試行を終える
+		 * @detail			格納中の行をバイト列に変換し，試行終端を追加する
+		 */
+		inline void endTrial()
+		{
+			this->encodeChunk();
+			this->write(size_type(0));
+		}
+
+		/*!
+		 * @brief			変換済みのバイト列を取り出す
+		 * @return			std::string	変換済みのバイト列を返す
+		 * @detail			取り出したバイト列は削除される
+		 */
+		inline std::string take()
+		{
+			std::string _data;
+			_data.swap(this->data_);
+			return _data;
+		}
+
+		/*!
+		 * @brief			変換済みのバイト列のサイズを返す
+		 * @return			std::size_t	変換済みのバイト列のサイズを返す
+		 */
+		inline std::size_t data_size() const
+		{
+			return this->data_.size();
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	列ごとの格納領域と変換済みのバイト列が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return std::apply([](const auto&... __columns) { return (okl::memorySize(__columns) + ... + std::size_t(0)); }, this->columns_) + okl::memorySize(this->data_);
+		}
+
+		/*!
+		 * @brief			ヘッダーを返す
+		 * @return			std::string	ヘッダーのバイト列を返す
+		 */
+		static std::string header()
+		{
+			std::string _header("OKLT");
+			_header.push_back(static_cast<char>(1));
+			_header.push_back(static_cast<char>(column_num));
+			std::apply([&_header](const auto&... __values) {
+				((_header.push_back(static_cast<char>(kind<std::decay_t<decltype(__values)>>())), _header.push_back(static_cast<char>(sizeof(__values)))), ...);
+			}, tuple_type());
+			return _header;
+		}
+
+	private:
+		//!チャンクの行数
+		size_type chunk_size_;
+
+		//!格納中の行数
+		size_type size_;
+
+		//!列ごとの格納領域
+		columns_type columns_;
+
+		//!変換済みのバイト列
+		std::string data_;
+
+		/*!
+		 * @brief			値の種類を返す
+		 * @return			int	0:符号なし整数 1:符号付き整数 2:浮動小数点
+		 */
+		template<class __Value>
+		static constexpr int kind()
+		{
+			static_assert(std::is_arithmetic<__Value>::value, "BinaryTrace supports arithmetic columns only");
+			return std::is_floating_point<__Value>::value ? 2 : (std::is_signed<__Value>::value ? 1 : 0);
+		}
+
+		/*!
+		 * @brief			行を格納する
+		 * @param[in]		__row 行
+		 */
+		template<std::size_t... _N>
+		inline void set(const tuple_type& __row, std::index_sequence<_N...>)
+		{
+			((std::get<_N>(this->columns_)[this->size_] = std::get<_N>(__row)), ...);
+		}
+
+		/*!
+		 * @brief			格納中の行を返す
+		 * @param[in]		__row 行番号
+		 * @return			tuple_type	行を返す
+		 */
+		template<std::size_t... _N>
+		inline tuple_type row(const size_type __row, std::index_sequence<_N...>) const
+		{
+			return tuple_type(std::get<_N>(this->columns_)[__row]...);
+		}
+
+		/*!
+		 * @brief			値をバイト列に追加する
+		 * @param[in]		__value 値
+		 */
+		template<class __Value>
+		inline void write(const __Value& __value)
+		{
+			this->data_.append(reinterpret_cast<const char*>(&__value), sizeof(__Value));
+		}
+
+		/*!
+		 * @brief			格納中の行をチャンクとしてバイト列に変換する
+		 * @detail			格納中の行がなければ何もしない
+		 */
+		inline void encodeChunk()
+		{
+			if (this->size_ == 0) {
+				return;
+			}
+			this->write(this->size_);
+			std::apply([this](const auto&... __columns) {
+				(this->data_.append(reinterpret_cast<const char*>(__columns.data()), sizeof(typename std::decay_t<decltype(__columns)>::value_type) * this->size_), ...);
+			}, this->columns_);
+			this->size_ = 0;
+		}
+	};
+
+	/*!
+	 * @brief			バイナリ時系列トレースをCSVに変換する
+	 * @param[in]		__in バイナリ時系列トレース入力ストリーム
+	 * @param[out]		__out CSV出力ストリーム
+	 * @return			bool	正しく変換できたらtrue, 形式が不正ならfalseを返す
+	 * @detail			SearchInfoのテキスト形式の履歴ログと同じく，試行ごとに1列を1行に書き込む
+	 *					列の型は種類が2以下，サイズが1, 2, 4, 8バイトのいずれかで，浮動小数点数は4か8バイトであること 不正な列があれば変換しない
+	 *					BinaryTraceと同じバイト順の環境で用いる
+	 */
+	inline bool writeBinaryTraceAsCsv(std::istream& __in, std::ostream& __out)
+	{
+		char _magic[4];
+		if (!__in.read(_magic, 4) || std::memcmp(_magic, "OKLT", 4) != 0) {
+			return false;
+		}
+		const auto _version = __in.get();
+		const auto _column_num = __in.get();
+		if (_version != 1 || _column_num == std::char_traits<char>::eof()) {
+			return false;
+		}
+		std::vector<std::pair<int, int>> _types(static_cast<std::size_t>(_column_num));
+		for (auto& [_kind, _size] : _types) {
+			_kind = __in.get();
+			_size = __in.get();
+			if (!__in) {
+				return false;
+			}
+			//読み込み時に値を越えて複写しないように，変換できる型のみ受け付ける
+			if (_kind < 0 || 2 < _kind || (_size != 1 && _size != 2 && _size != 4 && _size != 8)) {
+				return false;
+			}
+			if (_kind == 2 && _size != sizeof(float) && _size != sizeof(double)) {
+				return false;
+			}
+		}
+
+		//試行ごとに列のバイト列をまとめる
+		std::vector<std::string> _columns(_types.size());
+		std::vector<char> _buffer;
+		std::uint32_t _size;
+		while (__in.read(reinterpret_cast<char*>(&_size), sizeof(_size))) {
+			if (_size == 0) {
+				for (std::size_t _column = 0; _column < _types.size(); ++_column) {
+					const auto [_kind, _value_size] = _types[_column];
+					const auto& _data = _columns[_column];
+					for (std::size_t _offset = 0; _offset + _value_size <= _data.size(); _offset += _value_size) {
+						const char* _value = _data.data() + _offset;
+						if (_kind == 2) {
+							if (_value_size == sizeof(float)) {
+								float _float; std::memcpy(&_float, _value, sizeof(_float)); __out << _float;
+							}
+							else {
+								double _double; std::memcpy(&_double, _value, sizeof(_double)); __out << _double;
+							}
+						}
+						else if (_kind == 1) {
+							std::int64_t _int = 0;
+							switch (_value_size) {
+							case 1: { std::int8_t _v; std::memcpy(&_v, _value, 1); _int = _v; break; }
+							case 2: { std::int16_t _v; std::memcpy(&_v, _value, 2); _int = _v; break; }
+							case 4: { std::int32_t _v; std::memcpy(&_v, _value, 4); _int = _v; break; }
+							default: { std::memcpy(&_int, _value, 8); break; }
+							}
+							__out << _int;
+						}
+						else {
+							std::uint64_t _uint = 0;
+							switch (_value_size) {
+							case 1: { std::uint8_t _v; std::memcpy(&_v, _value, 1); _uint = _v; break; }
+							case 2: { std::uint16_t _v; std::memcpy(&_v, _value, 2); _uint = _v; break; }
+							case 4: { std::uint32_t _v; std::memcpy(&_v, _value, 4); _uint = _v; break; }
+							default: { std::memcpy(&_uint, _value, 8); break; }
+							}
+							__out << _uint;
+						}
+						__out << ",";
+					}
+					__out << std::endl;
+					_columns[_column].clear();
+				}
+				continue;
+			}
+			for (std::size_t _column = 0; _column < _types.size(); ++_column) {
+				_buffer.resize(static_cast<std::size_t>(_size) * static_cast<std::size_t>(_types[_column].second));
+				if (!__in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()))) {
+					return false;
+				}
+				_columns[_column].append(_buffer.data(), _buffer.size());
+			}
+		}
+		return __in.eof() && __in.gcount() == 0;
+	}
+} /* namespace okl */
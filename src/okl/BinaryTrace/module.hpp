@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "BinaryTrace.hpp"
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include <iostream>
 #include <iomanip>
 
+#include "../MemorySize/module.hpp"
+
 namespace okl {
 	/*!
 	 *  @brief      ビット集合クラス
@@ -147,6 +149,15 @@ namespace okl {
 				return this->contains(__index);
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	ビットを格納する配列が確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const
+			{
+				return okl::memorySize(this->store_);
+			}
+
 		private:
 			//!サイズ変数
 			size_type size_;
@@ -0,0 +1,287 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      チェックポイントクラス
+	 *  @details    試行の区切りで探索の再開に必要な状態をバイナリファイルに保存し，読み込む
+	 *				各試行は試行開始時に試行ごとのシードで探索クラスと演算子を初期化するため，
+	 *				次の試行番号とシード生成用の乱数エンジンの状態から以降の試行を逐次実行時と同じ結果で再現できる
+	 *				出力ファイルは保存時のサイズを記録し，再開時にそのサイズまで切り詰めて追記する
+	 *
+	 *				形式(値はすべて書き込んだ環境のバイト順の64bit符号なし整数)
+	 *				- "OKLC", 版数, 試行回数, 初期シード, 次の試行番号
+	 *				- 乱数エンジンの状態の要素数, 状態
+	 *				- 出力ファイル数, 出力ファイルサイズ
+	 */
+	class Checkpoint
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		Checkpoint() : interval_(0), max_times_(0), seed_(0), next_trial_(1), is_loaded_(false) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~Checkpoint() = default;
+
+		using size_type = std::uint64_t;
+		using state_type = std::vector<size_type>;
+
+		/*!
+		 * @brief			保存先を設定
+		 * @param[in]		__path チェックポイントファイルパス 空文字列なら保存しない
+		 * @param[in]		__interval 保存間隔 何試行ごとに保存するか 0なら保存しない
+		 */
+		inline void setPath(const std::string& __path, const size_type __interval)
+		{
+			this->path_ = __path;
+			this->interval_ = __interval;
+		}
+
+		/*!
+		 * @brief			チェックポイントファイルパスを返す
+		 * @return			std::string	チェックポイントファイルパスを返す
+		 */
+		inline const std::string& path() const
+		{
+			return this->path_;
+		}
+
+		/*!
+		 * @brief			保存間隔を返す
+		 * @return			size_type	保存間隔を返す
+		 */
+		constexpr size_type interval() const
+		{
+			return this->interval_;
+		}
+
+		/*!
+		 * @brief			チェックポイントを読み込んだか
+		 * @return			bool	読み込んだならtrueを返す
+		 */
+		constexpr bool isLoaded() const
+		{
+			return this->is_loaded_;
+		}
+
+		/*!
+		 * @brief			次の試行番号を返す
+		 * @return			size_type	次の試行番号を返す 1始まり
+		 */
+		constexpr size_type next_trial() const
+		{
+			return this->next_trial_;
+		}
+
+		/*!
+		 * @brief			出力ファイルサイズを返す
+		 * @return			std::vector<std::uint64_t>	保存時の出力ファイルサイズを返す
+		 */
+		inline const std::vector<std::uint64_t>& output_sizes() const
+		{
+			return this->output_sizes_;
+		}
+
+		/*!
+		 * @brief			実行する試行回数と初期シードを設定
+		 * @param[in]		__max_times 試行回数
+		 * @param[in]		__seed 初期シード
+		 * @detail			読み込んだチェックポイントと異なれば，読み込んだ内容を破棄して最初から実行する
+		 */
+		inline void setRun(const size_type __max_times, const size_type __seed)
+		{
+			if (this->max_times_ != __max_times || this->seed_ != __seed) {
+				this->is_loaded_ = false;
+				this->next_trial_ = 1;
+			}
+			this->max_times_ = __max_times;
+			this->seed_ = __seed;
+		}
+
+		/*!
+		 * @brief			指定の試行の後に保存するか判定
+		 * @param[in]		__trial 終了した試行番号
+		 * @return			bool	保存するならtrueを返す
+		 * @detail			保存間隔ごとと最終試行の後に保存する
+		 */
+		inline bool isSaveTrial(const size_type __trial) const
+		{
+			return !this->path_.empty() && this->interval_ != 0 && (__trial % this->interval_ == 0 || __trial == this->max_times_);
+		}
+
+		/*!
+		 * @brief			チェックポイントを読み込む
+		 * @param[in]		__max_times 試行回数
+		 * @param[in]		__seed 初期シード
+		 * @return			bool	読み込めたらtrueを返す
+		 * @detail			ファイルがない，形式が不正，または試行回数か初期シードが異なる場合は読み込まず最初から実行する
+		 */
+		bool load(const size_type __max_times, const size_type __seed)
+		{
+			this->max_times_ = __max_times;
+			this->seed_ = __seed;
+			this->next_trial_ = 1;
+			this->is_loaded_ = false;
+
+			std::ifstream _fin(this->path_, std::ios_base::in | std::ios_base::binary);
+			char _magic[4];
+			if (!_fin || !_fin.read(_magic, 4) || std::string(_magic, 4) != "OKLC") {
+				return false;
+			}
+			size_type _version = 0, _max_times = 0, _seed = 0, _next_trial = 0;
+			if (!read(_fin, _version) || _version != 1 || !read(_fin, _max_times) || !read(_fin, _seed) || !read(_fin, _next_trial)) {
+				return false;
+			}
+			if (_max_times != __max_times || _seed != __seed) {
+				return false;
+			}
+			state_type _engine_state;
+			std::vector<std::uint64_t> _output_sizes;
+			if (!read(_fin, _engine_state) || !read(_fin, _output_sizes)) {
+				return false;
+			}
+
+			this->next_trial_ = _next_trial;
+			this->engine_state_ = std::move(_engine_state);
+			this->output_sizes_ = std::move(_output_sizes);
+			this->is_loaded_ = true;
+			return true;
+		}
+
+		/*!
+		 * @brief			チェックポイントを保存する
+		 * @param[in]		__next_trial 次の試行番号
+		 * @param[in]		__engine_state 次の試行のシードを生成する乱数エンジンの状態
+		 * @param[in]		__output_sizes 出力ファイルサイズ
+		 * @detail			一時ファイルに書き込んでから置き換えるため，保存中に中断しても直前のチェックポイントは壊れない
+		 *					出力ファイルは保存前にフラッシュを完了させておく
+		 */
+		void save(const size_type __next_trial, const state_type& __engine_state, const std::vector<std::uint64_t>& __output_sizes) const
+		{
+			const auto _temporary_path = this->path_ + ".tmp";
+			{
+				std::ofstream _fout(_temporary_path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+				_fout.write("OKLC", 4);
+				write(_fout, size_type(1));
+				write(_fout, this->max_times_);
+				write(_fout, this->seed_);
+				write(_fout, __next_trial);
+				write(_fout, __engine_state);
+				write(_fout, __output_sizes);
+				if (!_fout.flush()) {
+					return;
+				}
+			}
+			std::error_code _error;
+			std::filesystem::rename(_temporary_path, this->path_, _error);
+		}
+
+		/*!
+		 * @brief			乱数エンジンの状態を返す
+		 * @param[in]		__engine 乱数エンジン
+		 * @return			state_type	乱数エンジンの状態を返す
+		 */
+		template<class __Engine>
+		static state_type engineState(const __Engine& __engine)
+		{
+			std::stringstream _stream;
+			_stream << __engine;
+			state_type _state;
+			for (size_type _value; _stream >> _value;) {
+				_state.push_back(_value);
+			}
+			return _state;
+		}
+
+		/*!
+		 * @brief			乱数エンジンの状態を読み込んだ状態に戻す
+		 * @param[out]		__engine 乱数エンジン
+		 * @detail			チェックポイントを読み込んでいなければ何もしない
+		 */
+		template<class __Engine>
+		void restoreEngine(__Engine& __engine) const
+		{
+			if (!this->is_loaded_) {
+				return;
+			}
+			std::stringstream _stream;
+			for (const auto _value : this->engine_state_) {
+				_stream << _value << " ";
+			}
+			_stream >> __engine;
+		}
+
+	private:
+		//!チェックポイントファイルパス
+		std::string path_;
+
+		//!保存間隔
+		size_type interval_;
+
+		//!試行回数
+		size_type max_times_;
+
+		//!初期シード
+		size_type seed_;
+
+		//!次の試行番号
+		size_type next_trial_;
+
+		//!読み込んだか
+		bool is_loaded_;
+
+		//!読み込んだ乱数エンジンの状態
+		state_type engine_state_;
+
+		//!読み込んだ出力ファイルサイズ
+		std::vector<std::uint64_t> output_sizes_;
+
+		/*!
+		 * @brief			値を書き込む
+		 */
+		static void write(std::ostream& __out, const size_type __value)
+		{
+			__out.write(reinterpret_cast<const char*>(&__value), sizeof(__value));
+		}
+
+		/*!
+		 * @brief			値の配列を要素数とともに書き込む
+		 */
+		static void write(std::ostream& __out, const std::vector<size_type>& __values)
+		{
+			write(__out, static_cast<size_type>(__values.size()));
+			__out.write(reinterpret_cast<const char*>(__values.data()), static_cast<std::streamsize>(__values.size() * sizeof(size_type)));
+		}
+
+		/*!
+		 * @brief			値を読み込む
+		 */
+		static bool read(std::istream& __in, size_type& __value)
+		{
+			return static_cast<bool>(__in.read(reinterpret_cast<char*>(&__value), sizeof(__value)));
+		}
+
+		/*!
+		 * @brief			要素数とともに書き込んだ値の配列を読み込む
+		 */
+		static bool read(std::istream& __in, std::vector<size_type>& __values)
+		{
+			size_type _size = 0;
+			if (!read(__in, _size) || (1 << 20) < _size) {
+				return false;
+			}
+			__values.resize(static_cast<std::size_t>(_size));
+			return static_cast<bool>(__in.read(reinterpret_cast<char*>(__values.data()), static_cast<std::streamsize>(__values.size() * sizeof(size_type))));
+		}
+	};
+} /* namespace okl */
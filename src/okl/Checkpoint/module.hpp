@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Checkpoint.hpp"
\ No newline at end of file
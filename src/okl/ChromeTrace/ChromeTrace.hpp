@@ -0,0 +1,298 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+//OKL_TRACEを定義すると演算子と探索の段階の区間をChrome trace-event形式で記録する
+//定義しなければOKL_TRACE_SCOPEは何も行わない
+#ifdef OKL_TRACE
+#define OKL_TRACE_CONCAT_(__a, __b) __a##__b
+#define OKL_TRACE_CONCAT(__a, __b) OKL_TRACE_CONCAT_(__a, __b)
+#define OKL_TRACE_SCOPE(__name, __info, __search_info) \
+	static const std::uint_least32_t OKL_TRACE_CONCAT(_okl_trace_name_, __LINE__) = okl::ChromeTrace::intern(__name, __info); \
+	const okl::ChromeTraceScope OKL_TRACE_CONCAT(_okl_trace_scope_, __LINE__)(OKL_TRACE_CONCAT(_okl_trace_name_, __LINE__), (__search_info).trial())
+#else
+#define OKL_TRACE_SCOPE(__name, __info, __search_info) ((void)0)
+#endif
+
+namespace okl {
+	/*!
+	 *  @brief      Chrome trace-event形式の区間記録クラス
+	 *  @details    区間はスレッドごとのバッファに追記し，close関数で全スレッドの区間をJSONに書き込む
+	 *				追記はロックを取らず，名前の登録とバッファの登録のみロックを取る
+	 *				間引き設定
+	 *				- 試行間隔		1+試行間隔*kの試行のみ記録する
+	 *				- 最小区間長		これより短い区間は記録しない
+	 *				- 最大区間数		スレッドごとの記録数の上限 超えた区間は数のみ数える
+	 */
+	class ChromeTrace
+	{
+	public:
+		/*!
+		 * @brief			記録を開始する
+		 * @param[in]		__path 書き込み先のJSONファイルパス
+		 * @param[in]		__trial_interval 記録する試行の間隔 1なら全試行
+		 * @param[in]		__min_duration 記録する最小区間長[ns]
+		 * @param[in]		__max_events スレッドごとの最大区間数 0なら上限なし
+		 * @detail			探索を始める前に呼び出す
+		 */
+		static void open(const std::string& __path, const std::size_t __trial_interval = 1, const std::uint_least64_t __min_duration = 0, const std::size_t __max_events = 0)
+		{
+			auto& _state = state();
+			std::lock_guard<std::mutex> _lock(_state.mutex_);
+			_state.path_ = __path;
+			_state.trial_interval_ = __trial_interval == 0 ? 1 : __trial_interval;
+			_state.min_duration_ = __min_duration;
+			_state.max_events_ = __max_events;
+			_state.origin_ = std::chrono::steady_clock::now();
+			_state.is_enabled_.store(!__path.empty(), std::memory_order_release);
+		}
+
+		/*!
+		 * @brief			記録中か
+		 * @return			bool	open関数で書き込み先を設定し，close関数を呼び出していなければtrueを返す
+		 */
+		static bool isEnabled()
+		{
+			return state().is_enabled_.load(std::memory_order_acquire);
+		}
+
+		/*!
+		 * @brief			試行を記録するか
+		 * @param[in]		__trial 試行番号 1始まり 0は試行外
+		 * @return			bool	記録するならtrueを返す
+		 */
+		static bool isSampled(const std::size_t __trial)
+		{
+			return isEnabled() && (__trial == 0 || (__trial - 1) % state().trial_interval_ == 0);
+		}
+
+		/*!
+		 * @brief			区間名を登録する
+		 * @param[in]		__name 表示名
+		 * @param[in]		__info 詳細 表示名と同じなら省略する
+		 * @return			std::uint_least32_t	区間名の番号を返す
+		 * @detail			OKL_TRACE_SCOPEが呼び出し箇所ごとに一度だけ呼び出す
+		 */
+		static std::uint_least32_t intern(const std::string& __name, const std::string& __info)
+		{
+			auto& _state = state();
+			std::lock_guard<std::mutex> _lock(_state.mutex_);
+			_state.names_.emplace_back(__name, __info == __name ? "" : __info);
+			return static_cast<std::uint_least32_t>(_state.names_.size() - 1);
+		}
+
+		/*!
+		 * @brief			区間を記録する
+		 * @param[in]		__name 区間名の番号
+		 * @param[in]		__begin 開始時刻
+		 * @param[in]		__end 終了時刻
+		 * @detail			呼び出したスレッドのバッファに追記する
+		 */
+		static void record(const std::uint_least32_t __name, const std::chrono::steady_clock::time_point __begin, const std::chrono::steady_clock::time_point __end)
+		{
+			auto& _state = state();
+			const auto _duration = static_cast<std::uint_least64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(__end - __begin).count());
+			if (_duration < _state.min_duration_) {
+				return;
+			}
+			auto& _buffer = localBuffer();
+			if (_state.max_events_ != 0 && _state.max_events_ <= _buffer.events_.size()) {
+				++_buffer.dropped_num_;
+				return;
+			}
+			_buffer.events_.push_back({ __name, static_cast<std::int_least64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(__begin - _state.origin_).count()), _duration });
+		}
+
+		/*!
+		 * @brief			記録を終了し，JSONに書き込む
+		 * @return			bool	書き込めればtrueを返す 記録中でなければfalseを返す
+		 * @detail			全ての探索スレッドが終了してから呼び出す
+		 *					時刻はopen関数の呼び出しからのマイクロ秒とする
+		 */
+		static bool close()
+		{
+			auto& _state = state();
+			if (!_state.is_enabled_.exchange(false)) {
+				return false;
+			}
+			std::lock_guard<std::mutex> _lock(_state.mutex_);
+			std::ofstream _out(_state.path_);
+			if (!_out) {
+				return false;
+			}
+			_out << "{\"traceEvents\":[\n";
+			_out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"okl\"}}";
+			for (std::size_t _tid = 0; _tid < _state.buffers_.size(); ++_tid) {
+				const auto& _buffer = *_state.buffers_[_tid];
+				_out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << _tid << ",\"args\":{\"name\":\"thread " << _tid << "\",\"dropped\":" << _buffer.dropped_num_ << "}}";
+				for (const auto& _event : _buffer.events_) {
+					const auto& [_name, _info] = _state.names_[_event.name_];
+					_out << ",\n{\"name\":\"" << escape(_name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << _tid
+						<< ",\"ts\":" << _event.begin_ / 1000 << "." << digits3(_event.begin_ % 1000)
+						<< ",\"dur\":" << _event.duration_ / 1000 << "." << digits3(_event.duration_ % 1000);
+					if (!_info.empty()) {
+						_out << ",\"args\":{\"info\":\"" << escape(_info) << "\"}";
+					}
+					_out << "}";
+				}
+			}
+			_out << "\n]}\n";
+			_state.buffers_.clear();
+			_state.generation_.fetch_add(1, std::memory_order_release);
+			return static_cast<bool>(_out);
+		}
+
+	private:
+		/*!
+		 *  @brief      区間
+		 */
+		struct Event
+		{
+			//!区間名の番号
+			std::uint_least32_t name_;
+			//!開始時刻[ns]
+			std::int_least64_t begin_;
+			//!区間長[ns]
+			std::uint_least64_t duration_;
+		};
+
+		/*!
+		 *  @brief      スレッドごとのバッファ
+		 */
+		struct Buffer
+		{
+			//!区間
+			std::vector<Event> events_;
+			//!最大区間数を超えて記録しなかった数
+			std::size_t dropped_num_ = 0;
+			//!登録した記録の世代
+			std::size_t generation_ = 0;
+		};
+
+		/*!
+		 *  @brief      記録の状態
+		 */
+		struct State
+		{
+			std::mutex mutex_;
+			std::atomic<bool> is_enabled_{ false };
+			std::string path_;
+			std::size_t trial_interval_ = 1;
+			std::uint_least64_t min_duration_ = 0;
+			std::size_t max_events_ = 0;
+			std::chrono::steady_clock::time_point origin_;
+			//!区間名と詳細
+			std::vector<std::pair<std::string, std::string>> names_;
+			//!スレッドごとのバッファ スレッド終了後もclose関数まで保持する
+			std::vector<std::shared_ptr<Buffer>> buffers_;
+			//!記録の世代 close関数で進め，以前の世代のバッファを登録し直させる
+			std::atomic<std::size_t> generation_{ 0 };
+		};
+
+		static State& state()
+		{
+			static State _state;
+			return _state;
+		}
+
+		/*!
+		 * @brief			呼び出したスレッドのバッファを返す
+		 * @detail			最初の呼び出しで全体のバッファ一覧に登録する
+		 *					close関数の後は世代が変わるため，新しいバッファを登録し直す
+		 */
+		static Buffer& localBuffer()
+		{
+			thread_local std::shared_ptr<Buffer> _buffer;
+			auto& _state = state();
+			if (!_buffer || _buffer->generation_ != _state.generation_.load(std::memory_order_acquire)) {
+				std::lock_guard<std::mutex> _lock(_state.mutex_);
+				_buffer = std::make_shared<Buffer>();
+				_buffer->generation_ = _state.generation_.load(std::memory_order_relaxed);
+				_state.buffers_.push_back(_buffer);
+			}
+			return *_buffer;
+		}
+
+		/*!
+		 * @brief			小数点以下3桁の文字列を返す
+		 */
+		static std::string digits3(const std::int_least64_t __value)
+		{
+			const auto _string = std::to_string(__value < 0 ? -__value : __value);
+			return std::string(3 - std::min<std::size_t>(_string.size(), 3), '0') + _string;
+		}
+
+		/*!
+		 * @brief			JSON文字列用にエスケープする
+		 */
+		static std::string escape(const std::string& __string)
+		{
+			std::string _escaped;
+			_escaped.reserve(__string.size());
+			for (const auto _char : __string) {
+				if (_char == '"' || _char == '\\') {
+					_escaped += '\\';
+					_escaped += _char;
+				}
+				else if (static_cast<unsigned char>(_char) < 0x20) {
+					_escaped += ' ';
+				}
+				else {
+					_escaped += _char;
+				}
+			}
+			return _escaped;
+		}
+	};
+
+	/*!
+	 *  @brief      区間の記録
+	 *  @details    生成から破棄までを一つの区間として記録する
+	 *				記録しない試行では時刻も取得しない
+	 */
+	class ChromeTraceScope
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 * @param[in]			__name 区間名の番号
+		 * @param[in]			__trial 試行番号
+		 */
+		ChromeTraceScope(const std::uint_least32_t __name, const std::size_t __trial) : name_(__name), is_sampled_(ChromeTrace::isSampled(__trial))
+		{
+			if (this->is_sampled_) {
+				this->begin_ = std::chrono::steady_clock::now();
+			}
+		}
+
+		ChromeTraceScope(const ChromeTraceScope&) = delete;
+		ChromeTraceScope& operator=(const ChromeTraceScope&) = delete;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		~ChromeTraceScope()
+		{
+			if (this->is_sampled_) {
+				ChromeTrace::record(this->name_, this->begin_, std::chrono::steady_clock::now());
+			}
+		}
+
+	private:
+		//!区間名の番号
+		std::uint_least32_t name_;
+		//!記録するか
+		bool is_sampled_;
+		//!開始時刻
+		std::chrono::steady_clock::time_point begin_;
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ChromeTrace.hpp"
\ No newline at end of file
@@ -6,6 +6,7 @@ namespace okl {
 	 *  @brief      設定時間以上か判定
 	 *  @details    設定時間以上か判定する
 	 *				設定時間以上ならTrue
+	 *				実時間で判定し，時計は探索情報に設定した判定間隔の呼び出しごとにのみ読む
 	 */
 	class TimerCondition : public Condition
 	{
@@ -32,9 +33,9 @@ namespace okl {
 		 * @detail			クラスに関連付けられた演算を実行する
 		 */
 		template<class __SearchInfo, class __Solution>
-		constexpr bool operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, const __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) const
+		inline bool operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, const __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) const
 		{
-			return __search_info.run_time() <= __search_info.cpu_time() && __search_info.run_time() != 0;
+			return __search_info.isTimeOver();
 		}
 	};
 } /* namespace okl */
\ No newline at end of file
@@ -238,6 +238,15 @@ namespace okl {
 				return this->adjacents_[__id];
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	頂点配列と隣接配列が確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const override
+			{
+				return Graph<__Vertex, __Edge, __Degree, __Vertices>::memory_size() + okl::memorySize(this->adjacents_);
+			}
+
 		private:
 			//!隣接配列
 			__AdjacentContainers adjacents_;
@@ -217,6 +217,15 @@ namespace okl {
 				return this->vertices_;
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	頂点配列が確保しているヒープ領域[byte]を返す
+			 */
+			inline virtual std::size_t memory_size() const
+			{
+				return okl::memorySize(this->vertices_);
+			}
+
 		protected:
 			//!辺の数
 			edge_size_type edge_size_;
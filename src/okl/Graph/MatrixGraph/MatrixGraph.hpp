@@ -41,6 +41,7 @@ namespace okl {
 			using size_type = typename MatrixGraphBase<__Vertex, __Edge, __Degree, __Vertices, __AdjacentMatrix>::size_type;
 			using edge_size_type = typename MatrixGraphBase<__Vertex, __Edge, __Degree, __Vertices, __AdjacentMatrix>::edge_size_type;
 			using vertices_container = typename MatrixGraphBase<__Vertex, __Edge, __Degree, __Vertices, __AdjacentMatrix>::vertices_container;
+			using adjacent_matrix_type = typename MatrixGraphBase<__Vertex, __Edge, __Degree, __Vertices, __AdjacentMatrix>::adjacent_matrix_type;
 
 			using has_adjacent = std::false_type;
 			using has_non_adjacent = std::false_type;
@@ -41,6 +41,7 @@ namespace okl {
 			using size_type = typename Graph<__Vertex, __Edge, __Degree, __Vertices>::size_type;
 			using edge_size_type = typename Graph<__Vertex, __Edge, __Degree, __Vertices>::edge_size_type;
 			using vertices_container = typename Graph<__Vertex, __Edge, __Degree, __Vertices>::vertices_container;
+			using adjacent_matrix_type = __AdjacentMatrix;
 
 			using has_adjacent = std::false_type;
 			using has_non_adjacent = std::false_type;
@@ -153,6 +154,15 @@ namespace okl {
 					[this, __id](const auto& _vertex) { return this->existsDirectedEdge(__id, _vertex.id()); }));
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	頂点配列と隣接行列が確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const override
+			{
+				return Graph<__Vertex, __Edge, __Degree, __Vertices>::memory_size() + okl::memorySize(this->adjacent_matrix_);
+			}
+
 		protected:
 			//!辺行列
 			__AdjacentMatrix adjacent_matrix_;
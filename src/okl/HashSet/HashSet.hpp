@@ -7,6 +7,7 @@
 #include <iostream>
 #include <iomanip>
 #include "../Hash/module.hpp"
+#include "../MemorySize/module.hpp"
 
 namespace okl {
 	/*!
@@ -32,6 +33,17 @@ namespace okl {
 			 */
 			HashSet() : size_(0) {}
 
+			/*!
+			 * @brief				コピーコンストラクタ
+			 */
+			HashSet(const HashSet&) = default;
+
+			/*!
+			 * @brief				ムーブコンストラクタ
+			 * @detail				格納領域を引き継ぐ 移動元は再度resizeするまで使用しないこと
+			 */
+			HashSet(HashSet&&) noexcept = default;
+
 			/*!
 			 * @brief				デストラクタ
 			 */
@@ -402,6 +414,26 @@ namespace okl {
 				return *this;
 			}
 
+			/*!
+			* @brief			ムーブ代入処理を行う
+			* @param[in]		__other 代入元対象
+			* @return			HashSet&	自分自身の参照を返す
+			* @detail			格納領域を引き継ぐ 移動元は再度resizeするまで使用しないこと
+			*/
+			HashSet& operator=(HashSet&&) noexcept = default;
+
+			/*!
+			* @brief			要素を交換する
+			* @param[in,out]	__other 交換対象
+			* @detail			格納領域ごと交換するため，要素の複製は行わない
+			*/
+			inline void swap(HashSet& __other) noexcept
+			{
+				std::swap(this->size_, __other.size_);
+				this->store_.swap(__other.store_);
+				this->location_.swap(__other.location_);
+			}
+
 			/*!
 			* @brief			比較対象より小さいか比較を行う
 			* @param[in]		__other 比較対象
@@ -472,6 +504,15 @@ namespace okl {
 				return std::move(this->store_[__index]);
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	要素と格納場所の配列が確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const
+			{
+				return okl::memorySize(this->store_) + okl::memorySize(this->location_);
+			}
+
 		protected:
 			//!サイズ変数
 			size_type size_;
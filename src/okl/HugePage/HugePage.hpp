@@ -0,0 +1,199 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace okl {
+	/*!
+	 *  @brief      ヒュージページ確保クラス
+	 *  @details    大きな領域を2MBのヒュージページで確保し，巨大な距離行列へのランダムアクセスでのTLBミスを減らす
+	 *				確保方法
+	 *				- none		通常のページで確保する
+	 *				- madvise	透過的ヒュージページ(THP)をmadvise(MADV_HUGEPAGE)で要求する
+	 *				- hugetlb	予約済みのヒュージページ(hugetlbfs)をMAP_HUGETLBで確保し，確保できなければmadviseで確保する
+	 *				ヒュージページサイズ以上の領域はLinuxでは確保方法によらずmmapで確保し，ヒュージページサイズ境界に揃える
+	 *				ヒュージページを使えない環境では通常のページで確保し，探索はそのまま続ける
+	 *				確保方法は探索を始める前にsetMode関数で設定する
+	 */
+	class HugePage
+	{
+	public:
+		//!ヒュージページサイズ[byte]
+		static constexpr std::size_t page_size = std::size_t(2) << 20;
+
+		//!通常のページで確保する
+		static constexpr int none = 0;
+		//!透過的ヒュージページを要求する
+		static constexpr int madvise = 1;
+		//!予約済みのヒュージページで確保する
+		static constexpr int hugetlb = 2;
+
+		/*!
+		 * @brief			確保方法を設定する
+		 * @param[in]		__mode 確保方法 none，madvise，hugetlbのいずれか
+		 * @detail			設定後に確保した領域のみに反映する
+		 */
+		static void setMode(const int __mode)
+		{
+			state().mode_.store(__mode, std::memory_order_relaxed);
+		}
+
+		/*!
+		 * @brief			確保方法を返す
+		 * @return			int	確保方法を返す
+		 */
+		static int mode()
+		{
+			return state().mode_.load(std::memory_order_relaxed);
+		}
+
+		/*!
+		 * @brief			ヒュージページを要求した領域の合計を返す
+		 * @return			std::size_t	確保中の領域のうち，ヒュージページを要求できた領域の合計[byte]を返す
+		 * @detail			madviseはカーネルへの要求のため，実際にヒュージページが割り当てられたかは/proc/meminfoのAnonHugePagesで確認する
+		 */
+		static std::size_t bytes()
+		{
+			auto& _state = state();
+			std::lock_guard<std::mutex> _lock(_state.mutex_);
+			std::size_t _bytes = 0;
+			for (const auto& _block : _state.blocks_) {
+				_bytes += _block.second;
+			}
+			return _bytes;
+		}
+
+		/*!
+		 * @brief			領域を確保する
+		 * @param[in]		__bytes 確保するサイズ[byte]
+		 * @return			void*	確保した領域の先頭を返す
+		 * @detail			確保できなければstd::bad_allocを送出する
+		 */
+		static void* allocate(const std::size_t __bytes)
+		{
+#if defined(__linux__)
+			if (isLarge(__bytes)) {
+				const auto _bytes = roundUp(__bytes);
+				if (mode() == hugetlb) {
+					void* _data = ::mmap(nullptr, _bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+					if (_data != MAP_FAILED) {
+						state().add(_data, _bytes);
+						return _data;
+					}
+				}
+				//境界に揃えるため，ヒュージページ1枚分多く確保して前後の余りを解放する
+				void* _mapped = ::mmap(nullptr, _bytes + page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (_mapped == MAP_FAILED) {
+					throw std::bad_alloc();
+				}
+				const auto _address = reinterpret_cast<std::uintptr_t>(_mapped);
+				const auto _aligned = (_address + page_size - 1) / page_size * page_size;
+				if (_address < _aligned) {
+					::munmap(_mapped, _aligned - _address);
+				}
+				::munmap(reinterpret_cast<void*>(_aligned + _bytes), _address + page_size - _aligned);
+				void* _data = reinterpret_cast<void*>(_aligned);
+				if (mode() != none && ::madvise(_data, _bytes, MADV_HUGEPAGE) == 0) {
+					state().add(_data, _bytes);
+				}
+				return _data;
+			}
+#endif
+			return ::operator new(__bytes);
+		}
+
+		/*!
+		 * @brief			領域を解放する
+		 * @param[in]		__data allocate関数で確保した領域の先頭
+		 * @param[in]		__bytes allocate関数で確保したサイズ[byte]
+		 */
+		static void deallocate(void* const __data, const std::size_t __bytes)
+		{
+#if defined(__linux__)
+			if (isLarge(__bytes)) {
+				state().remove(__data);
+				::munmap(__data, roundUp(__bytes));
+				return;
+			}
+#endif
+			::operator delete(__data);
+		}
+
+	private:
+		/*!
+		 * @brief      確保の状態
+		 */
+		struct State {
+			//!確保方法
+			std::atomic<int> mode_{ none };
+			//!ヒュージページを要求した領域の先頭とサイズ 大きな領域のみなので数は少ない
+			std::vector<std::pair<void*, std::size_t>> blocks_;
+			//!領域一覧の排他制御
+			std::mutex mutex_;
+
+			/*!
+			 * @brief			ヒュージページを要求した領域を記録する
+			 * @param[in]		__data 領域の先頭
+			 * @param[in]		__bytes 領域のサイズ[byte]
+			 */
+			void add(void* const __data, const std::size_t __bytes)
+			{
+				std::lock_guard<std::mutex> _lock(this->mutex_);
+				this->blocks_.emplace_back(__data, __bytes);
+			}
+
+			/*!
+			 * @brief			領域の記録を削除する
+			 * @param[in]		__data 領域の先頭
+			 */
+			void remove(void* const __data)
+			{
+				std::lock_guard<std::mutex> _lock(this->mutex_);
+				this->blocks_.erase(std::remove_if(this->blocks_.begin(), this->blocks_.end(),
+					[__data](const auto& _block) { return _block.first == __data; }), this->blocks_.end());
+			}
+		};
+
+		/*!
+		 * @brief			確保の状態を返す
+		 * @return			State&	プロセスで共有する確保の状態を返す
+		 */
+		static State& state()
+		{
+			static State _state;
+			return _state;
+		}
+
+		/*!
+		 * @brief			ヒュージページで確保する大きさか
+		 * @param[in]		__bytes 確保するサイズ[byte]
+		 * @return			bool	ヒュージページサイズ以上ならtrueを返す
+		 */
+		static constexpr bool isLarge(const std::size_t __bytes)
+		{
+			return page_size <= __bytes;
+		}
+
+		/*!
+		 * @brief			ヒュージページサイズの倍数に切り上げる
+		 * @param[in]		__bytes サイズ[byte]
+		 * @return			std::size_t	切り上げたサイズ[byte]を返す
+		 */
+		static constexpr std::size_t roundUp(const std::size_t __bytes)
+		{
+			return (__bytes + page_size - 1) / page_size * page_size;
+		}
+	};
+} /* namespace okl */
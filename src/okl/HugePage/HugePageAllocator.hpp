@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include "HugePage.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      ヒュージページアロケータクラス
+	 *  @details    HugePageクラスで領域を確保する標準ライブラリ互換のアロケータ
+	 *				行列コンテナなどの大きな配列に指定し，ヒュージページサイズ以上の領域をヒュージページで確保する
+	 *				状態を持たないため，全てのインスタンスは等しい
+	 *				- __Value				要素型
+	 */
+	template<typename __Value>
+	class HugePageAllocator
+	{
+	public:
+		using value_type = __Value;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::true_type;
+
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		HugePageAllocator() = default;
+
+		/*!
+		 * @brief				変換コンストラクタ
+		 */
+		template<typename __Other>
+		constexpr HugePageAllocator(const HugePageAllocator<__Other>&) noexcept {}
+
+		/*!
+		 * @brief			領域を確保する
+		 * @param[in]		__size 要素数
+		 * @return			value_type*	確保した領域の先頭を返す
+		 */
+		inline value_type* allocate(const size_type __size)
+		{
+			if (std::numeric_limits<size_type>::max() / sizeof(value_type) < __size) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<value_type*>(HugePage::allocate(__size * sizeof(value_type)));
+		}
+
+		/*!
+		 * @brief			領域を解放する
+		 * @param[in]		__data allocate関数で確保した領域の先頭
+		 * @param[in]		__size allocate関数で確保した要素数
+		 */
+		inline void deallocate(value_type* const __data, const size_type __size)
+		{
+			HugePage::deallocate(__data, __size * sizeof(value_type));
+		}
+	};
+
+	/*!
+	 * @brief			等価演算子
+	 * @return			bool	常にTrueを返す
+	 */
+	template<typename __Value, typename __Other>
+	constexpr bool operator==(const HugePageAllocator<__Value>&, const HugePageAllocator<__Other>&)
+	{
+		return true;
+	}
+
+	/*!
+	 * @brief			非等価演算子
+	 * @return			bool	常にFalseを返す
+	 */
+	template<typename __Value, typename __Other>
+	constexpr bool operator!=(const HugePageAllocator<__Value>&, const HugePageAllocator<__Other>&)
+	{
+		return false;
+	}
+} /* namespace okl */
@@ -0,0 +1,3 @@
+﻿#pragma once
+#include "HugePage.hpp"
+#include "HugePageAllocator.hpp"
\ No newline at end of file
@@ -0,0 +1,290 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include "../AsyncWriter/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      改善イベントクラス
+	 *  @details    試行中に最良解が改善したときの情報
+	 *				- __Cost				コスト数値型
+	 */
+	template<class __Cost>
+	class ImprovementEvent
+	{
+	public:
+		using cost_type = __Cost;
+
+		//!試行番号
+		std::size_t trial_;
+
+		//!改善後の解の値
+		cost_type cost_;
+
+		//!試行開始からの経過時間[s]
+		double time_;
+
+		//!試行開始からのスレッドCPU時間[s] 計測開始したスレッド以外からの通知では負の値
+		double cpu_time_;
+
+		//!改善後の解 ImprovementSubscriber::isSolutionRequired()がfalseなら空文字列
+		std::string solution_;
+	};
+
+	/*!
+	 *  @brief      改善イベント購読基底クラス
+	 *  @details    探索情報クラスに登録し，試行中の最良解の改善を受け取る
+	 *				複数のスレッドの探索情報クラスから共有されるため，notify関数はスレッドセーフに実装する
+	 *				- __Cost				コスト数値型
+	 */
+	template<class __Cost>
+	class ImprovementSubscriber
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ImprovementSubscriber() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ImprovementSubscriber() = default;
+
+		using event_type = ImprovementEvent<__Cost>;
+
+		/*!
+		 * @brief			改善後の解の文字列を必要とするか
+		 * @return			bool	必要ならtrueを返す
+		 */
+		virtual bool isSolutionRequired() const = 0;
+
+		/*!
+		 * @brief			解の名前を返す
+		 * @return			std::string	解を文字列にする際の名前を返す
+		 */
+		virtual std::string name() const = 0;
+
+		/*!
+		 * @brief			改善イベントを受け取る
+		 * @param[in]		__event 改善イベント
+		 */
+		virtual void notify(const event_type& __event) = 0;
+
+		/*!
+		 * @brief			試行の終了を受け取る
+		 * @param[in]		__trial 試行番号
+		 * @detail			試行ごとに保持している情報を捨てる 既定では何もしない
+		 */
+		virtual void endTrial(const std::size_t __trial) {}
+
+		/*!
+		 * @brief			出力の書き込みを完了させる
+		 * @detail			チェックポイントの保存前に呼び出される 既定では何もしない
+		 */
+		virtual void sync() {}
+
+		/*!
+		 * @brief			出力ファイルサイズを返す
+		 * @return			std::uint64_t	出力ファイルサイズ[byte]を返す 既定では0
+		 * @detail			sync関数の後に呼び出される チェックポイントから再開する際の切り詰めに用いる
+		 */
+		virtual std::uint64_t output_size() const
+		{
+			return 0;
+		}
+	};
+
+	/*!
+	 *  @brief      改善イベント書き込みクラス
+	 *  @details    改善イベントを1行1レコードのJSON形式でファイルまたは名前付きパイプに書き込む
+	 *				書き込みは非同期書き込みクラスで行うため，探索スレッドは書き込みを待たない
+	 *				入れ子の探索やスレッドごとの探索情報クラスからの通知のうち，試行ごとに解の値が改善したものだけを書き込む
+	 *				試行ごとの書き込んだ解の値は試行の終了時に捨てるため，保持するのは実行中の試行の分のみ
+	 *				チェックポイントから再開する場合，保存時より後に書き込んだ改善イベントは再実行する試行の分として書き込み直される
+	 *				- __Cost						コスト数値型
+	 *				- __CostComparisonFunction		コスト比較関数 (a, b)でaがbより悪いならtrue
+	 */
+	template<
+		class __Cost,
+		class __CostComparisonFunction>
+		class ImprovementStream : public ImprovementSubscriber<__Cost>
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ImprovementStream() : is_solution_required_(false) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ImprovementStream() = default;
+
+		using event_type = typename ImprovementSubscriber<__Cost>::event_type;
+		using cost_type = __Cost;
+		using cost_comparison_function = __CostComparisonFunction;
+
+		/*!
+		 * @brief			書き込み先を開く
+		 * @param[in]		__path ファイルパスまたは名前付きパイプのパス
+		 * @param[in]		__name 問題例名
+		 * @param[in]		__is_solution_required 改善後の解も書き込むか
+		 * @param[in]		__mode 開くモード 再開時に保存時のサイズが分からなければ追記モードにする
+		 * @detail			名前付きパイプは読み込み側が開くまで書き込みスレッドで待つ
+		 */
+		inline void open(const std::string& __path, const std::string& __name, const bool __is_solution_required, const std::ios_base::openmode __mode = std::ios_base::out)
+		{
+			this->setup(__name, __is_solution_required);
+			this->writer_.open(0, __path, __mode);
+		}
+
+		/*!
+		 * @brief			書き込み先を指定サイズから追記するように開く
+		 * @param[in]		__path ファイルパスまたは名前付きパイプのパス
+		 * @param[in]		__name 問題例名
+		 * @param[in]		__is_solution_required 改善後の解も書き込むか
+		 * @param[in]		__size チェックポイントに保存したファイルサイズ[byte]
+		 * @detail			ファイルが__sizeより大きければ__sizeに切り詰めてから追記する
+		 */
+		inline void resume(const std::string& __path, const std::string& __name, const bool __is_solution_required, const std::uint64_t __size)
+		{
+			this->setup(__name, __is_solution_required);
+			this->writer_.resume(0, __path, __size);
+		}
+
+		/*!
+		 * @brief			改善後の解の文字列を必要とするか
+		 * @return			bool	必要ならtrueを返す
+		 */
+		inline virtual bool isSolutionRequired() const override
+		{
+			return this->is_solution_required_;
+		}
+
+		/*!
+		 * @brief			解の名前を返す
+		 * @return			std::string	問題例名を返す
+		 */
+		inline virtual std::string name() const override
+		{
+			return this->name_;
+		}
+
+		/*!
+		 * @brief			改善イベントを受け取る
+		 * @param[in]		__event 改善イベント
+		 * @detail			試行内でそれまでに書き込んだ解の値より良ければJSON形式で書き込み，すぐにフラッシュを要求する
+		 */
+		inline virtual void notify(const event_type& __event) override
+		{
+			std::lock_guard<std::mutex> _lock(this->mutex_);
+			const auto _best_cost = this->best_costs_.find(__event.trial_);
+			if (_best_cost != this->best_costs_.end() && !cost_comparison_function()(_best_cost->second, __event.cost_)) {
+				return;
+			}
+			this->best_costs_[__event.trial_] = __event.cost_;
+
+			std::ostringstream _record;
+			_record << std::setprecision(std::numeric_limits<double>::digits10);
+			_record << "{\"instance\":\"" << escape(this->name_) << "\",\"trial\":" << __event.trial_ << ",\"cost\":" << __event.cost_
+				<< ",\"time\":" << __event.time_;
+			//他のスレッドから通知されたCPU時間は意味を持たないため書き込まない
+			if (0 <= __event.cpu_time_) {
+				_record << ",\"cpu_time\":" << __event.cpu_time_;
+			}
+			if (this->is_solution_required_) {
+				_record << ",\"solution\":\"" << escape(__event.solution_) << "\"";
+			}
+			_record << "}\n";
+			this->writer_.write(0, _record.str());
+			this->writer_.flush();
+		}
+
+		/*!
+		 * @brief			試行の終了を受け取る
+		 * @param[in]		__trial 試行番号
+		 * @detail			試行の書き込んだ最良の解の値を捨てる
+		 */
+		inline virtual void endTrial(const std::size_t __trial) override
+		{
+			std::lock_guard<std::mutex> _lock(this->mutex_);
+			this->best_costs_.erase(__trial);
+		}
+
+		/*!
+		 * @brief			出力の書き込みを完了させる
+		 */
+		inline virtual void sync() override
+		{
+			this->writer_.sync();
+		}
+
+		/*!
+		 * @brief			出力ファイルサイズを返す
+		 * @return			std::uint64_t	出力ファイルサイズ[byte]を返す
+		 */
+		inline virtual std::uint64_t output_size() const override
+		{
+			return static_cast<std::uint64_t>(this->writer_.size(0));
+		}
+
+	private:
+		//!問題例名
+		std::string name_;
+
+		//!改善後の解も書き込むか
+		bool is_solution_required_;
+
+		//!試行ごとの書き込んだ最良の解の値
+		std::unordered_map<std::size_t, cost_type> best_costs_;
+
+		//!通知の排他制御
+		std::mutex mutex_;
+
+		//!非同期書き込み
+		AsyncWriter writer_;
+
+		/*!
+		 * @brief			書き込み先を開く前の設定を行う
+		 * @param[in]		__name 問題例名
+		 * @param[in]		__is_solution_required 改善後の解も書き込むか
+		 * @detail			前の書き込み先の試行ごとの書き込んだ解の値は捨てる
+		 */
+		inline void setup(const std::string& __name, const bool __is_solution_required)
+		{
+			std::lock_guard<std::mutex> _lock(this->mutex_);
+			this->name_ = __name;
+			this->is_solution_required_ = __is_solution_required;
+			this->best_costs_.clear();
+		}
+
+		/*!
+		 * @brief			JSONの文字列としてエスケープする
+		 * @param[in]		__string 文字列
+		 * @return			std::string	エスケープした文字列を返す
+		 */
+		static std::string escape(const std::string& __string)
+		{
+			std::string _escaped;
+			_escaped.reserve(__string.size());
+			for (const auto _char : __string) {
+				switch (_char) {
+				case '"': _escaped += "\\\""; break;
+				case '\\': _escaped += "\\\\"; break;
+				case '\n': _escaped += "\\n"; break;
+				case '\r': _escaped += "\\r"; break;
+				case '\t': _escaped += "\\t"; break;
+				default: _escaped += _char; break;
+				}
+			}
+			return _escaped;
+		}
+	};
+} /* namespace okl */
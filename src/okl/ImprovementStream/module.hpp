@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ImprovementStream.hpp"
\ No newline at end of file
@@ -0,0 +1,149 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      有界ロックフリーキュークラス
+	 *  @details    送信側1スレッド，受信側1スレッドで使用する固定長のロックフリーキュー
+	 *				要素は事前に確保した領域に代入で格納するため，要素の追加と取り出しでメモリ確保を行わない
+	 *				- __Value				要素型
+	 */
+	template<
+		typename __Value>
+		class LockFreeQueue {
+		public:
+			/*!
+			 * @brief				コンストラクタ
+			 */
+			LockFreeQueue() : head_(0), tail_(0) {}
+
+			/*!
+			 * @brief				コピーコンストラクタ
+			 * @param[in]			__other コピー元
+			 * @detail				格納領域のみ複製し，要素は空にする
+			 */
+			LockFreeQueue(const LockFreeQueue& __other) : slots_(__other.slots_), head_(0), tail_(0) {}
+
+			/*!
+			 * @brief				デストラクタ
+			 */
+			virtual ~LockFreeQueue() = default;
+
+			using value_type = __Value;
+			using size_type = std::size_t;
+
+			/*!
+			 * @brief			代入処理を行う
+			 * @param[in]		__other 代入元対象
+			 * @return			LockFreeQueue&	自身の参照を返す
+			 * @detail			格納領域のみ複製し，要素は空にする
+			 */
+			LockFreeQueue& operator=(const LockFreeQueue& __other)
+			{
+				this->slots_ = __other.slots_;
+				this->clear();
+				return *this;
+			}
+
+			/*!
+			 * @brief			全要素初期化
+			 * @detail			全要素を削除する
+			 *					メモリ解放は行わない
+			 *					送信側と受信側のスレッドが動作していないときに呼び出す
+			 */
+			inline void clear()
+			{
+				this->head_.store(0, std::memory_order_relaxed);
+				this->tail_.store(0, std::memory_order_relaxed);
+			}
+
+			/*!
+			 * @brief			サイズ設定
+			 * @param[in]		__capacity 最大要素数
+			 * @param[in]		__value 格納領域の初期値 メモリ確保済みの要素を指定する
+			 * @detail			格納領域をメモリ確保を行う
+			 */
+			inline void resize(const size_type __capacity, const value_type& __value = value_type())
+			{
+				this->slots_.assign(__capacity + 1, __value);
+				this->clear();
+			}
+
+			/*!
+			 * @brief			最大要素数を返す
+			 * @return			size_type	最大要素数を返す
+			 */
+			inline size_type capacity() const
+			{
+				return this->slots_.empty() ? 0 : this->slots_.size() - 1;
+			}
+
+			/*!
+			 * @brief			空か判定する
+			 * @return			bool	空ならTrue
+			 * @detail			受信側から呼び出す
+			 */
+			inline bool isEmpty() const
+			{
+				return this->head_.load(std::memory_order_relaxed) == this->tail_.load(std::memory_order_acquire);
+			}
+
+			/*!
+			 * @brief			要素を追加する
+			 * @param[in]		__value 追加する要素
+			 * @return			bool	追加したならTrue 満杯ならFalse
+			 * @detail			送信側から呼び出す
+			 */
+			inline bool push(const value_type& __value)
+			{
+				const auto _tail = this->tail_.load(std::memory_order_relaxed);
+				const auto _next = this->next(_tail);
+				if (_next == this->head_.load(std::memory_order_acquire)) {
+					return false;
+				}
+				this->slots_[_tail] = __value;
+				this->tail_.store(_next, std::memory_order_release);
+				return true;
+			}
+
+			/*!
+			 * @brief			要素を取り出す
+			 * @param[out]		__value 取り出した要素の代入先
+			 * @return			bool	取り出したならTrue 空ならFalse
+			 * @detail			受信側から呼び出す
+			 */
+			inline bool pop(value_type& __value)
+			{
+				const auto _head = this->head_.load(std::memory_order_relaxed);
+				if (_head == this->tail_.load(std::memory_order_acquire)) {
+					return false;
+				}
+				__value = this->slots_[_head];
+				this->head_.store(this->next(_head), std::memory_order_release);
+				return true;
+			}
+
+		private:
+			//!格納領域 満杯と空を区別するため最大要素数+1
+			std::vector<value_type> slots_;
+
+			//!先頭位置 受信側が更新する
+			alignas(64) std::atomic<size_type> head_;
+
+			//!末尾位置 送信側が更新する
+			alignas(64) std::atomic<size_type> tail_;
+
+			/*!
+			 * @brief			次の位置を返す
+			 * @param[in]		__index 位置
+			 * @return			size_type	次の位置を返す
+			 */
+			inline size_type next(const size_type __index) const
+			{
+				return __index + 1 == this->slots_.size() ? 0 : __index + 1;
+			}
+	};
+} /* namespace okl */
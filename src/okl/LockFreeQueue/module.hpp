@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "LockFreeQueue.hpp"
\ No newline at end of file
@@ -90,6 +90,15 @@ namespace okl {
 				return this->matrix_[__row][__column];
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	要素のコンテナが確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const override
+			{
+				return okl::memorySize(this->matrix_);
+			}
+
 		private:
 			//!行列コンテナ
 			__Matrix matrix_;
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <iostream>
+#include "../MemorySize/module.hpp"
 
 namespace okl {
 	/*!
@@ -59,6 +60,15 @@ namespace okl {
 				return this->size_;
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	派生クラスが格納する要素の領域[byte]を返す 基底クラスは0を返す
+			 */
+			inline virtual std::size_t memory_size() const
+			{
+				return 0;
+			}
+
 		protected:
 			//!サイズ
 			size_type size_;
@@ -107,6 +107,15 @@ namespace okl {
 				}
 			}
 
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	要素のコンテナが確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const override
+			{
+				return okl::memorySize(this->container_);
+			}
+
 		private:
 			//!要素アクセスのためのサイズに依存した定数
 			size_type alpha_;
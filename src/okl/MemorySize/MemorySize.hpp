@@ -0,0 +1,118 @@
+﻿#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      memory_size関数を持つか判定する
+	 *  @details    const参照からmemory_size()を呼び出せるならtrue
+	 *				- __Type				判定する型
+	 */
+	template<class __Type, class = void>
+	struct HasMemorySize : std::false_type {};
+
+	template<class __Type>
+	struct HasMemorySize<__Type, std::void_t<decltype(std::declval<const __Type&>().memory_size())>> : std::true_type {};
+
+	//入れ子のコンテナから呼び出せるように全ての多重定義を先に宣言する
+	template<class __Type>
+	std::size_t memorySize(const __Type& __value);
+	template<class __Type, class __Allocator>
+	std::size_t memorySize(const std::vector<__Type, __Allocator>& __vector);
+	template<class __Type, std::size_t __Size>
+	std::size_t memorySize(const std::array<__Type, __Size>& __array);
+	template<class __Char, class __Traits, class __Allocator>
+	std::size_t memorySize(const std::basic_string<__Char, __Traits, __Allocator>& __string);
+	template<class __Type>
+	std::size_t memorySize(const std::shared_ptr<__Type>& __pointer);
+
+	/*!
+	 * @brief			可変長配列が確保しているヒープ領域のバイト数を返す
+	 * @param[in]		__vector 可変長配列
+	 * @return			std::size_t	確保済み容量分の要素と，各要素が確保している領域の合計[byte]を返す
+	 */
+	template<class __Type, class __Allocator>
+	std::size_t memorySize(const std::vector<__Type, __Allocator>& __vector)
+	{
+		if constexpr (std::is_same_v<__Type, bool>) {
+			return (__vector.capacity() + 7) / 8;
+		}
+		else {
+			std::size_t _size = __vector.capacity() * sizeof(__Type);
+			if constexpr (!std::is_arithmetic_v<__Type>) {
+				for (const auto& _value : __vector) {
+					_size += memorySize(_value);
+				}
+			}
+			return _size;
+		}
+	}
+
+	/*!
+	 * @brief			固定長配列の各要素が確保しているヒープ領域のバイト数を返す
+	 * @param[in]		__array 固定長配列
+	 * @return			std::size_t	各要素が確保している領域の合計[byte]を返す 配列自体は含まない
+	 */
+	template<class __Type, std::size_t __Size>
+	std::size_t memorySize(const std::array<__Type, __Size>& __array)
+	{
+		std::size_t _size = 0;
+		if constexpr (!std::is_arithmetic_v<__Type>) {
+			for (const auto& _value : __array) {
+				_size += memorySize(_value);
+			}
+		}
+		return _size;
+	}
+
+	/*!
+	 * @brief			文字列が確保しているヒープ領域のバイト数を返す
+	 * @param[in]		__string 文字列
+	 * @return			std::size_t	短い文字列をオブジェクト内に格納する場合は0を返す
+	 */
+	template<class __Char, class __Traits, class __Allocator>
+	std::size_t memorySize(const std::basic_string<__Char, __Traits, __Allocator>& __string)
+	{
+		//短い文字列はオブジェクト内の領域に格納される
+		if (__string.capacity() < sizeof(std::basic_string<__Char, __Traits, __Allocator>) / sizeof(__Char)) {
+			return 0;
+		}
+		return (__string.capacity() + 1) * sizeof(__Char);
+	}
+
+	/*!
+	 * @brief			共有ポインタが指すオブジェクトの領域のバイト数を返す
+	 * @param[in]		__pointer 共有ポインタ
+	 * @return			std::size_t	指すオブジェクトとそれが確保している領域の合計[byte]を返す
+	 * @detail			共有している領域も所有者ごとに数える
+	 */
+	template<class __Type>
+	std::size_t memorySize(const std::shared_ptr<__Type>& __pointer)
+	{
+		return __pointer ? sizeof(__Type) + memorySize(*__pointer) : 0;
+	}
+
+	/*!
+	 * @brief			オブジェクトが確保しているヒープ領域のバイト数を返す
+	 * @param[in]		__value オブジェクト
+	 * @return			std::size_t	memory_size関数を持つならその値を，持たないなら0を返す
+	 * @detail			オブジェクト自体の大きさ(sizeof)は含まない
+	 *					各クラスのmemory_size関数は，メンバが確保している領域をこの関数で合計して返す
+	 */
+	template<class __Type>
+	std::size_t memorySize(const __Type& __value)
+	{
+		if constexpr (HasMemorySize<__Type>::value) {
+			return __value.memory_size();
+		}
+		else {
+			return 0;
+		}
+	}
+} /* namespace okl */
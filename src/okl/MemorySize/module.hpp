@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "MemorySize.hpp"
\ No newline at end of file
@@ -54,6 +54,18 @@ namespace okl {
 			this->operator_.resize(static_cast<typename __Operator::size_type>(__size));
 		}
 
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定する
+		 * 					- seed_typeは標準ライブラリによって定義される
+		 */
+		inline void seed(const seed_type __seed) override
+		{
+			Operator::seed(__seed);
+			this->operator_.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+		}
+
 		/*!
 		 * @brief			クラスに関連付けられた演算を実行
 		 * @detail			クラスに関連付けられた演算を実行する
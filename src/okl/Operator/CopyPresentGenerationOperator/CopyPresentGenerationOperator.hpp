@@ -0,0 +1,47 @@
+﻿#pragma once
+#include "../Operator.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      現世代複製処理関数クラス
+	 *  @details    現世代の各個体の複製を次世代に生む関数クラス
+	 *				交叉の代わりに用いると，次世代に変異を加えても親は現世代に残るため，選択で親と子から良い個体を残せる
+	 *				母集団の最大個体数は母集団サイズの2倍以上であること
+	 */
+	class CopyPresentGenerationOperator : public Operator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		CopyPresentGenerationOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~CopyPresentGenerationOperator() = default;
+
+		using random_device_type = typename Operator::random_device_type;
+		using seed_type = typename Operator::seed_type;
+		using size_type = typename Operator::size_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return "現世代の複製"; }
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			現世代の個体ごとに1個体を生み，複製する
+		 */
+		template<class __SearchInfo, class __Solution, class _Population>
+		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
+		{
+			assert(__population.size() + __population.present_generation().size() <= __population.capacity());
+			for (const auto _individual_id : __population.present_generation()) {
+				__population.born() = __population.individual(_individual_id);
+			}
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "CopyPresentGenerationOperator.hpp"
\ No newline at end of file
@@ -81,6 +81,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution)
 		{
+			OKL_TRACE_SCOPE("If", info(), __search_info);
 			if (this->condition_(__graph, __search_info, __solution)) {
 				this->operator_a_(__graph, __search_info, __solution);
 			}
@@ -96,6 +97,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution, __Solution& __initial_solution, __Solution& __best_solution)
 		{
+			OKL_TRACE_SCOPE("If", info(), __search_info);
 			if (this->condition_(__graph, __search_info, __solution, __initial_solution, __best_solution)) {
 				this->operator_a_(__graph, __search_info, __solution, __initial_solution, __best_solution);
 			}
@@ -111,6 +113,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution, class _Container>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution, __Solution& __initial_solution, __Solution& __best_solution, const _Container& __target_vertex_set)
 		{
+			OKL_TRACE_SCOPE("If", info(), __search_info);
 			if (this->condition_(__graph, __search_info, __solution, __initial_solution, __best_solution)) {
 				this->operator_a_(__graph, __search_info, __solution, __initial_solution, __best_solution, __target_vertex_set);
 			}
@@ -126,6 +129,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution, class _Population>
 		inline typename std::enable_if<!std::is_same<__Solution, _Population>::value>::type operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
 		{
+			OKL_TRACE_SCOPE("If", info(), __search_info);
 			if (this->condition_(__graph, __search_info, __population, __initial_solution, __best_solution)) {
 				this->operator_a_(__graph, __search_info, __population, __initial_solution, __best_solution);
 			}
@@ -3,6 +3,8 @@
 #include "../Random/module.hpp"
 #include "../Stack/module.hpp"
 #include "../Timer/module.hpp"
+#include "../ChromeTrace/module.hpp"
+#include "../MemorySize/module.hpp"
 
 #include <cassert>
 
@@ -0,0 +1,55 @@
+﻿#pragma once
+#include "../ParallelPopulationOperator.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      並列個体生成関数クラス
+	 *  @details    母集団サイズまで個体を生成し，生成した個体に指定の操作を並列に行う関数クラス
+	 *				個体は事前にまとめて確保してから並列に生成する
+	 *				- __Operator			操作関数クラス
+	 *				- __SearchInfo			探索情報クラス
+	 *				- __ThreadNum			スレッド数 0ならハードウェアの並列数
+	 */
+	template<
+		class __Operator,
+		class __SearchInfo,
+		std::size_t __ThreadNum = 0>
+	class ParallelBornPopulationDoOperator : public ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ParallelBornPopulationDoOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ParallelBornPopulationDoOperator() = default;
+
+		using random_device_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::random_device_type;
+		using seed_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::seed_type;
+		using size_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::size_type;
+
+		/*!
+		 * @brief				オペレーター名
+		 * @return				std::string	このオペレーターの名前を返す
+		 */
+		static const std::string info() { return "設定個体並列生成し(" + __Operator::info() + ")"; }
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __Solution, class _Population>
+		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
+		{
+			this->individual_ids_.clear();
+			if (__population.size() < __search_info.pop_size()) {
+				__population.born(static_cast<typename _Population::size_type>(__search_info.pop_size() - __population.size()), this->individual_ids_);
+			}
+			this->apply(__graph, __search_info, __population, __initial_solution, __best_solution);
+			__population.advanceGeneration();
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ParallelBornPopulationDoOperator.hpp"
\ No newline at end of file
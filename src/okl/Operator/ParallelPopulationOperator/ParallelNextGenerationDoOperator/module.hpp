@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ParallelNextGenerationDoOperator.hpp"
\ No newline at end of file
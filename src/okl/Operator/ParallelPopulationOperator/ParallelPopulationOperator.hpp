@@ -0,0 +1,145 @@
+﻿#pragma once
+#include "../Operator.hpp"
+#include "../../Parallel/module.hpp"
+
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      並列個体処理関数クラス基底
+	 *  @details    指定の個体群に操作関数を並列に適用する関数クラスの基底クラス
+	 *				スレッドごとに操作関数クラスの複製を持ち，各複製のシードは自身の乱数生成機から生成する
+	 *				個体はスレッド番号順に等間隔で割り当てるため，スレッド数が同じなら結果は再現する
+	 *				スレッドごとの探索情報はメンバとして持ち回し，処理ごとに初期化して処理後に元の探索情報に統合する
+	 *				- __Operator			操作関数クラス
+	 *				- __SearchInfo			探索情報クラス
+	 *				- __ThreadNum			スレッド数 0ならハードウェアの並列数
+	 */
+	template<
+		class __Operator,
+		class __SearchInfo,
+		std::size_t __ThreadNum = 0>
+	class ParallelPopulationOperator : public Operator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ParallelPopulationOperator() : operators_(threadNum(__ThreadNum)), search_infos_(operators_.size()), size_(0) {}
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 * @detail				探索情報クラスは複製できないため，スレッドごとの探索情報は複製せずに作り直す
+		 */
+		ParallelPopulationOperator(const ParallelPopulationOperator& __other) :
+			Operator(__other), individual_ids_(__other.individual_ids_), operators_(__other.operators_), search_infos_(operators_.size()), size_(__other.size_)
+		{
+			for (auto& _search_info : this->search_infos_) {
+				_search_info.resize(static_cast<typename search_info_type::size_type>(this->size_));
+			}
+		}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ParallelPopulationOperator() = default;
+
+		using random_device_type = typename Operator::random_device_type;
+		using seed_type = typename Operator::seed_type;
+		using size_type = typename Operator::size_type;
+		using search_info_type = __SearchInfo;
+
+		/*!
+		 * @brief			全要素初期化
+		 * @detail			全要素を初期化処理を行う
+		 *					メモリ解放は行わない
+		 */
+		inline void clear() override
+		{
+			Operator::clear();
+			for (auto& _operator : this->operators_) {
+				_operator.clear();
+			}
+		}
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size サイズ
+		 * @detail			全要素をメモリ確保を行う
+		 *					スレッドごとの探索情報もここで確保し，処理ごとには確保し直さない
+		 */
+		inline void resize(const size_type __size) override
+		{
+			Operator::resize(__size);
+			assert(__size <= std::numeric_limits<typename __Operator::size_type>::max());
+			for (auto& _operator : this->operators_) {
+				_operator.resize(static_cast<typename __Operator::size_type>(__size));
+			}
+			this->size_ = __size;
+			for (auto& _search_info : this->search_infos_) {
+				_search_info.resize(static_cast<typename search_info_type::size_type>(__size));
+			}
+		}
+
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定する
+		 * 					- seed_typeは標準ライブラリによって定義される
+		 */
+		inline void seed(const seed_type __seed) override
+		{
+			Operator::seed(__seed);
+			for (auto& _operator : this->operators_) {
+				_operator.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+			}
+		}
+
+	protected:
+		//!個体IDの一時領域
+		std::vector<std::size_t> individual_ids_;
+
+		/*!
+		 * @brief			個体群に操作関数を並列に適用する
+		 * @param[in]		__graph グラフクラス
+		 * @param[out]		__search_info 探索情報クラス
+		 * @param[out]		__population 母集団クラス
+		 * @param[in]		__initial_solution 初期解
+		 * @param[in]		__best_solution 最良解 処理中は読み取りのみ
+		 * @detail			individual_ids_の個体に操作関数を並列に適用する
+		 */
+		template<class __Solution, class _Population>
+		inline void apply(typename __Solution::graph_type& __graph, search_info_type& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
+		{
+			const auto _thread_num = this->operators_.size();
+
+			for (auto& _search_info : this->search_infos_) {
+				_search_info.clear();
+				_search_info.copyParameters(__search_info);
+			}
+
+			parallelFor(_thread_num, _thread_num, [&](const std::size_t __index, const std::size_t __thread_id) {
+				//実時間の制限は共有し，CPU時間はこのスレッドで計測する
+				this->search_infos_[__index].syncTime(__search_info);
+				for (auto _id_index = __index; _id_index < this->individual_ids_.size(); _id_index += _thread_num) {
+					auto& _individual = __population.individual(static_cast<typename _Population::key_type>(this->individual_ids_[_id_index]));
+					this->operators_[__index](__graph, this->search_infos_[__index], _individual, __initial_solution, __best_solution);
+				}
+			});
+
+			for (const auto& _search_info : this->search_infos_) {
+				__search_info.merge(_search_info);
+			}
+		}
+
+	private:
+		//!スレッドごとの操作関数
+		std::vector<__Operator> operators_;
+
+		//!スレッドごとの探索情報
+		std::vector<search_info_type> search_infos_;
+
+		//!頂点数
+		size_type size_;
+	};
+} /* namespace okl */
@@ -0,0 +1,50 @@
+﻿#pragma once
+#include "../ParallelPopulationOperator.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      並列現世代処理関数クラス
+	 *  @details    現世代全てに指定の操作を並列に行う関数クラス
+	 *				- __Operator			操作関数クラス
+	 *				- __SearchInfo			探索情報クラス
+	 *				- __ThreadNum			スレッド数 0ならハードウェアの並列数
+	 */
+	template<
+		class __Operator,
+		class __SearchInfo,
+		std::size_t __ThreadNum = 0>
+	class ParallelPresentGenerationDoOperator : public ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ParallelPresentGenerationDoOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ParallelPresentGenerationDoOperator() = default;
+
+		using random_device_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::random_device_type;
+		using seed_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::seed_type;
+		using size_type = typename ParallelPopulationOperator<__Operator, __SearchInfo, __ThreadNum>::size_type;
+
+		/*!
+		 * @brief				オペレーター名
+		 * @return				std::string	このオペレーターの名前を返す
+		 */
+		static const std::string info() { return "現世代に並列に(" + __Operator::info() + ")"; }
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __Solution, class _Population>
+		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
+		{
+			this->individual_ids_.assign(__population.present_generation().begin(), __population.present_generation().end());
+			this->apply(__graph, __search_info, __population, __initial_solution, __best_solution);
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ParallelPresentGenerationDoOperator.hpp"
\ No newline at end of file
@@ -0,0 +1,5 @@
+﻿#pragma once
+#include "ParallelPopulationOperator.hpp"
+#include "ParallelBornPopulationDoOperator/module.hpp"
+#include "ParallelPresentGenerationDoOperator/module.hpp"
+#include "ParallelNextGenerationDoOperator/module.hpp"
\ No newline at end of file
@@ -0,0 +1,48 @@
+﻿#pragma once
+
+#include "../Operator.hpp"
+#include "../../Profile/module.hpp"
+#include "../../PerfCounter/module.hpp"
+#include <utility>
+
+namespace okl {
+	/*!
+	 *  @brief      性能カウンタ計測関数クラス
+	 *  @details    __Operatorの呼び出しの前後で性能カウンタを読み，差分を段階__Phaseとして探索情報クラスに加算する
+	 *				探索情報クラスで計測が無効なら__Operatorをそのまま呼び出す
+	 *				- __Phase				段階 Profile::local_searchなど
+	 *				- __Operator			計測する関数クラス
+	 */
+	template<
+		std::size_t __Phase,
+		class __Operator>
+		class PerfCounterOperator : public __Operator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		PerfCounterOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~PerfCounterOperator() = default;
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			__Operatorの演算を実行し，計測が有効なら性能カウンタ値を探索情報クラスに加算する
+		 */
+		template<class __Graph, class __SearchInfo, class... __Args>
+		inline void operator()(__Graph& __graph, __SearchInfo& __search_info, __Args&&... __args)
+		{
+			if (!__search_info.isPerfCounterEnabled()) {
+				__Operator::operator()(__graph, __search_info, std::forward<__Args>(__args)...);
+				return;
+			}
+			const auto _begin = __search_info.readPerfCounter();
+			__Operator::operator()(__graph, __search_info, std::forward<__Args>(__args)...);
+			__search_info.addPerfCounter(__Phase, PerfCounter::difference(_begin, __search_info.readPerfCounter()));
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "PerfCounterOperator.hpp"
\ No newline at end of file
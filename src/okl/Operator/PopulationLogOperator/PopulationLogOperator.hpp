@@ -48,7 +48,7 @@ namespace okl {
 			);
 			const auto _best_cost = __population.individual(_best_individual_id).cost();
 
-			__search_info.setInfo(std::make_tuple(__search_info.best_result().get(), _best_cost, _avg_cost, __search_info.cpu_time(), __search_info.key_data(0), __search_info.key_data(1), __search_info.key_data(2), __search_info.key_data(3), __search_info.key_data(4), __search_info.key_data(5), __search_info.key_data(6)));
+			__search_info.setInfo(std::make_tuple(__search_info.best_result().get(), _best_cost, _avg_cost, __search_info.time(), __search_info.key_data(0), __search_info.key_data(1), __search_info.key_data(2), __search_info.key_data(3), __search_info.key_data(4), __search_info.key_data(5), __search_info.key_data(6)));
 		}
 	};
 } /* namespace okl */
\ No newline at end of file
@@ -0,0 +1,55 @@
+﻿#pragma once
+
+#include "../Operator.hpp"
+#include "../../Profile/module.hpp"
+#include <chrono>
+#include <utility>
+
+namespace okl {
+	/*!
+	 *  @brief      段階計測関数クラス
+	 *  @details    __Operatorの呼び出しを探索の段階__Phaseとして計測する
+	 *				計測値は探索情報クラスのprofile()に加算する
+	 *				OKL_PROFILEが定義されていなければ__Operatorをそのまま呼び出す
+	 *				- __Phase				段階 Profile::startなど
+	 *				- __Operator			計測する関数クラス
+	 */
+	template<
+		std::size_t __Phase,
+		class __Operator>
+		class ProfileOperator : public __Operator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ProfileOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ProfileOperator() = default;
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			__Operatorの演算を実行し，計測値を探索情報クラスに加算する
+		 */
+		template<class __Graph, class __SearchInfo, class... __Args>
+		inline void operator()(__Graph& __graph, __SearchInfo& __search_info, __Args&&... __args)
+		{
+#ifdef OKL_PROFILE
+			const auto _counter = Profile::local();
+			const auto _cpu_time = Timer::threadCpuTime();
+			const auto _start = std::chrono::steady_clock::now();
+			__Operator::operator()(__graph, __search_info, std::forward<__Args>(__args)...);
+			auto _difference = Profile::local() - _counter;
+			_difference.calls_ = 1;
+			_difference.wall_ns_ = static_cast<std::uint_least64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+			_difference.cpu_ns_ = static_cast<std::uint_least64_t>((Timer::threadCpuTime() - _cpu_time) * 1e9);
+			__search_info.profile().add(__Phase, _difference);
+#else
+			__Operator::operator()(__graph, __search_info, std::forward<__Args>(__args)...);
+#endif
+		}
+	};
+} /* namespace okl */
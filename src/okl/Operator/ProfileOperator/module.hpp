@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ProfileOperator.hpp"
\ No newline at end of file
@@ -88,6 +88,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution)
 		{
+			OKL_TRACE_SCOPE("SearchPrePost", info(), __search_info);
 			this->pre_operator_(__graph, __search_info, __solution);
 			this->search_(__graph, __search_info, __solution);
 			this->post_operator_(__graph, __search_info, __solution);
@@ -95,6 +96,15 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution, __Solution& __initial_solution, __Solution& __best_solution) { (*this)(__graph, __search_info, __solution); }
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	前後の演算と探索が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->pre_operator_) + okl::memorySize(this->search_) + okl::memorySize(this->post_operator_);
+		}
+
 	private:
 		//!前処理演算子
 		__PreOperator pre_operator_;
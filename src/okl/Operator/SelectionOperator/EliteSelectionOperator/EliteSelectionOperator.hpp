@@ -31,16 +31,16 @@ namespace okl {
 
 		/*!
 		 * @brief			クラスに関連付けられた演算を実行
-		 * @detail			クラスに関連付けられた演算を実行する
+		 * @detail			次世代を現世代に合わせて良い順に並べ，母集団サイズを超える分を悪い個体から殺す
 		 */
 		template<class __SearchInfo, class __Solution, class _Population>
 		inline void operator()(const typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, const __Solution& __initial_solution, __Solution& __best_solution)
 		{
 			__population.advanceGeneration();
-			__population.sortPresentGeneration([&__population](const auto x, const auto y) {return __population.individual(x).cost() < __population.individual(y).cost(); });
+			__population.sortPresentGeneration([&__population](const auto x, const auto y) {return __population.individual(y) < __population.individual(x); });
 
 			while (__search_info.pop_size() < __population.size()) {
-				const auto _individual_id = __population.next_generation().back();
+				const auto _individual_id = __population.present_generation().back();
 				__population.kill(_individual_id);
 			}
 		}
@@ -106,6 +106,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution)
 		{
+			OKL_TRACE_SCOPE("Sequence", info(), __search_info);
 			this->operator_a_(__graph, __search_info, __solution);
 			this->operator_b_(__graph, __search_info, __solution);
 			this->operator_c_(__graph, __search_info, __solution);
@@ -120,6 +121,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution, __Solution& __initial_solution, __Solution& __best_solution)
 		{
+			OKL_TRACE_SCOPE("Sequence", info(), __search_info);
 			this->operator_a_(__graph, __search_info, __solution, __initial_solution, __best_solution);
 			this->operator_b_(__graph, __search_info, __solution, __initial_solution, __best_solution);
 			this->operator_c_(__graph, __search_info, __solution, __initial_solution, __best_solution);
@@ -134,6 +136,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution, class _Population>
 		inline typename std::enable_if<!std::is_same<__Solution, _Population>::value>::type operator()(typename __Solution::graph_type& __graph, __SearchInfo& __search_info, _Population& __population, __Solution& __initial_solution, __Solution& __best_solution)
 		{
+			OKL_TRACE_SCOPE("Sequence", info(), __search_info);
 			this->operator_a_(__graph, __search_info, __population, __initial_solution, __best_solution);
 			this->operator_b_(__graph, __search_info, __population, __initial_solution, __best_solution);
 			this->operator_c_(__graph, __search_info, __population, __initial_solution, __best_solution);
@@ -46,6 +46,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(const typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution)
 		{
+			OKL_TRACE_SCOPE("StrategyControl", info(), __search_info);
 			using mode_type = typename __SearchInfo::mode_type;
 			this->stack_.clear();
 			for (mode_type _mode = __MinModeNum; _mode <= __MaxModeNum; ++_mode) {
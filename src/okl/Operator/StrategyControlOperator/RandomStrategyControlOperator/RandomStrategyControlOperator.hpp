@@ -45,6 +45,7 @@ namespace okl {
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(const typename __Solution::graph_type& __graph, __SearchInfo& __search_info, __Solution& __solution)
 		{
+			OKL_TRACE_SCOPE("StrategyControl", info(), __search_info);
 			const auto _select_mode = this->random_device_.uniform_int(__MinModeNum, __MaxModeNum);
 			__search_info.setMode(_select_mode);
 		}
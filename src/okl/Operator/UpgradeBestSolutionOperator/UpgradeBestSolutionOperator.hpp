@@ -38,7 +38,9 @@ namespace okl {
 		inline void operator()(const typename __Solution::graph_type& __graph, __SearchInfo& __search_info, const __Solution& __solution)
 		{
 			//if (__solution.meetConstraints()) {
-			__search_info.setResult(__solution.cost());
+			if (__search_info.setResult(__solution.cost())) {
+				__search_info.notifyImprovement(__solution);
+			}
 			//}
 		}
 		template<class __SearchInfo, class __Solution>
@@ -46,12 +48,12 @@ namespace okl {
 		{
 			if (__best_solution < __solution) {
 				__best_solution = __solution;
-				if (__solution.meetConstraints()) {
-					__search_info.setResult(__solution.cost());
+				if (__solution.meetConstraints() && __search_info.setResult(__solution.cost())) {
+					__search_info.notifyImprovement(__solution);
 				}
 			}
-			else {
-				__search_info.setResult(__best_solution.cost());
+			else if (__search_info.setResult(__best_solution.cost())) {
+				__search_info.notifyImprovement(__best_solution);
 			}
 		}
 	};
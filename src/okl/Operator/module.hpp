@@ -14,6 +14,8 @@
 #include "LoadBestSolutionOperator/module.hpp"
 #include "LoadInitialSolutionOperator/module.hpp"
 #include "SearchPrePostOperator/module.hpp"
+#include "ProfileOperator/module.hpp"
+#include "PerfCounterOperator/module.hpp"
 #include "SetModeOperator/module.hpp"
 #include "SetModeCostOperator/module.hpp"
 #include "StrategyControlOperator/module.hpp"
@@ -26,4 +28,6 @@
 #include "ExceptForBestIndividualOperator/module.hpp"
 #include "DuplicateIndividualOperator/module.hpp"
 #include "PopulationLogOperator/module.hpp"
-#include "BornPopulationDoOperator/module.hpp"
\ No newline at end of file
+#include "BornPopulationDoOperator/module.hpp"
+#include "CopyPresentGenerationOperator/module.hpp"
+#include "ParallelPopulationOperator/module.hpp"
\ No newline at end of file
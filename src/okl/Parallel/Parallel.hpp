@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace okl {
+	/*!
+	 * @brief			使用するスレッド数を返す
+	 * @param[in]		__thread_num 指定スレッド数
+	 * @return			std::size_t	使用するスレッド数を返す
+	 * @detail			__thread_numが0ならハードウェアの並列数を返す
+	 */
+	inline std::size_t threadNum(const std::size_t __thread_num)
+	{
+		if (__thread_num != 0) {
+			return __thread_num;
+		}
+		const std::size_t _hardware_concurrency = std::thread::hardware_concurrency();
+		return _hardware_concurrency == 0 ? 1 : _hardware_concurrency;
+	}
+
+	/*!
+	 * @brief			指定回数の処理を並列に行う
+	 * @param[in]		__thread_num スレッド数
+	 * @param[in]		__size 処理回数
+	 * @param[in]		__function 処理関数 __function(処理番号, スレッド番号)
+	 * @detail			0 <= 処理番号 < __size の処理を空いたスレッドに順に割り当てる
+	 *					スレッド番号0は呼び出し元のスレッドで実行される
+	 *					全ての処理が終わるまで戻らない
+	 */
+	template<class __Function>
+	inline void parallelFor(const std::size_t __thread_num, const std::size_t __size, __Function __function)
+	{
+		std::atomic<std::size_t> _next_index(0);
+		auto _worker = [&_next_index, &__function, __size](const std::size_t __thread_id) {
+			for (auto _index = _next_index.fetch_add(1); _index < __size; _index = _next_index.fetch_add(1)) {
+				__function(_index, __thread_id);
+			}
+		};
+
+		const auto _thread_num = std::min(threadNum(__thread_num), __size);
+		std::vector<std::thread> _threads;
+		_threads.reserve(_thread_num);
+		for (std::size_t _thread_id = 1; _thread_id < _thread_num; ++_thread_id) {
+			_threads.emplace_back(_worker, _thread_id);
+		}
+		_worker(0);
+		for (auto& _thread : _threads) {
+			_thread.join();
+		}
+	}
+} /* namespace okl */
\ No newline at end of file
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Parallel.hpp"
\ No newline at end of file
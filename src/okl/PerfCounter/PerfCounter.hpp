@@ -0,0 +1,211 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace okl {
+	/*!
+	 *  @brief      ハードウェア性能カウンタクラス
+	 *  @details    perf_event_openでサイクル数，命令数，LLCミス数，分岐予測ミス数を
+	 *				呼び出したスレッドのユーザ空間について計測する
+	 *				カウンタを開けない環境や，一部のイベントに対応していない環境では
+	 *				対応していないイベントの値をunavailableとし，探索は計測なしで続ける
+	 *				Linux以外では常に計測できない
+	 */
+	class PerfCounter
+	{
+	public:
+		//!イベント数
+		static constexpr std::size_t event_num = 4;
+
+		//!計測値型 サイクル数，命令数，LLCミス数，分岐予測ミス数の順
+		using values_type = std::array<std::uint_least64_t, event_num>;
+
+		//!計測できなかった値
+		static constexpr std::uint_least64_t unavailable = std::numeric_limits<std::uint_least64_t>::max();
+
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		PerfCounter() : is_opened_(false)
+		{
+			this->fds_.fill(-1);
+		}
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 */
+		PerfCounter(const PerfCounter&) = delete;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~PerfCounter()
+		{
+			this->close();
+		}
+
+		/*!
+		 * @brief			代入処理
+		 */
+		PerfCounter& operator=(const PerfCounter&) = delete;
+
+		/*!
+		 * @brief			イベント名を返す
+		 * @param[in]		__event イベント番号
+		 * @return			const char*	CSVの列名に用いるイベント名を返す
+		 */
+		static const char* eventName(const std::size_t __event)
+		{
+			static const char* const _names[event_num] = { "cycles", "instructions", "llc_misses", "branch_misses" };
+			return __event < event_num ? _names[__event] : "";
+		}
+
+		/*!
+		 * @brief			呼び出したスレッドのカウンタを開く
+		 * @return			bool	一つでもイベントを計測できればtrueを返す
+		 * @detail			二回目以降の呼び出しでは最初の結果を返す
+		 *					計測できないイベントがあれば理由をerror()で返す
+		 */
+		inline bool open()
+		{
+			if (this->is_opened_) {
+				return this->isAvailable();
+			}
+			this->is_opened_ = true;
+#if defined(__linux__)
+			static const std::uint64_t _configs[event_num] = {
+				PERF_COUNT_HW_CPU_CYCLES,
+				PERF_COUNT_HW_INSTRUCTIONS,
+				PERF_COUNT_HW_CACHE_MISSES,
+				PERF_COUNT_HW_BRANCH_MISSES
+			};
+			for (std::size_t _event = 0; _event < event_num; ++_event) {
+				perf_event_attr _attr;
+				std::memset(&_attr, 0, sizeof(_attr));
+				_attr.size = sizeof(_attr);
+				_attr.type = PERF_TYPE_HARDWARE;
+				_attr.config = _configs[_event];
+				_attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				_attr.exclude_kernel = 1;
+				_attr.exclude_hv = 1;
+				this->fds_[_event] = static_cast<int>(syscall(SYS_perf_event_open, &_attr, 0, -1, -1, 0));
+				if (this->fds_[_event] < 0 && this->error_.empty()) {
+					this->error_ = std::string(eventName(_event)) + ": " + std::strerror(errno);
+				}
+			}
+#else
+			this->error_ = "perf_event_open is not supported on this platform";
+#endif
+			return this->isAvailable();
+		}
+
+		/*!
+		 * @brief			カウンタを閉じる
+		 */
+		inline void close()
+		{
+#if defined(__linux__)
+			for (auto& _fd : this->fds_) {
+				if (0 <= _fd) {
+					::close(_fd);
+				}
+				_fd = -1;
+			}
+#endif
+		}
+
+		/*!
+		 * @brief			計測できるか
+		 * @return			bool	一つでもイベントを計測できればtrueを返す
+		 */
+		inline bool isAvailable() const
+		{
+			for (const auto _fd : this->fds_) {
+				if (0 <= _fd) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/*!
+		 * @brief			開けなかった理由を返す
+		 * @return			const std::string&	最初に開けなかったイベントと理由を返す 全て開けたら空文字列
+		 */
+		inline const std::string& error() const
+		{
+			return this->error_;
+		}
+
+		/*!
+		 * @brief			現在の計測値を返す
+		 * @return			values_type	開いてからの累計値を返す 計測できないイベントはunavailable
+		 * @detail			他のイベントとの多重化で計測されていない時間があれば，計測時間の割合で補正する
+		 *					区間の計測値は区間の前後の差をdifference関数で求める
+		 */
+		inline values_type read() const
+		{
+			values_type _values;
+			_values.fill(unavailable);
+#if defined(__linux__)
+			for (std::size_t _event = 0; _event < event_num; ++_event) {
+				std::uint64_t _data[3];
+				if (0 <= this->fds_[_event] && ::read(this->fds_[_event], _data, sizeof(_data)) == static_cast<ssize_t>(sizeof(_data))) {
+					_values[_event] = _data[2] == 0 || _data[2] == _data[1] ? _data[0] : static_cast<std::uint_least64_t>(static_cast<double>(_data[0]) * static_cast<double>(_data[1]) / static_cast<double>(_data[2]));
+				}
+			}
+#endif
+			return _values;
+		}
+
+		/*!
+		 * @brief			区間の計測値を返す
+		 * @param[in]		__begin 区間の開始時の計測値
+		 * @param[in]		__end 区間の終了時の計測値
+		 * @return			values_type	区間の計測値を返す どちらかがunavailableならunavailable
+		 */
+		static values_type difference(const values_type& __begin, const values_type& __end)
+		{
+			values_type _values;
+			for (std::size_t _event = 0; _event < event_num; ++_event) {
+				_values[_event] = __begin[_event] == unavailable || __end[_event] == unavailable ? unavailable : __end[_event] - __begin[_event];
+			}
+			return _values;
+		}
+
+		/*!
+		 * @brief			計測値を加算する
+		 * @param[in,out]	__values 加算先
+		 * @param[in]		__other 加算する計測値
+		 * @detail			どちらかがunavailableならunavailableとする
+		 */
+		static void add(values_type& __values, const values_type& __other)
+		{
+			for (std::size_t _event = 0; _event < event_num; ++_event) {
+				__values[_event] = __values[_event] == unavailable || __other[_event] == unavailable ? unavailable : __values[_event] + __other[_event];
+			}
+		}
+
+	private:
+		//!イベントごとのファイル記述子 開けなければ-1
+		std::array<int, event_num> fds_;
+
+		//!open関数を呼び出したか
+		bool is_opened_;
+
+		//!開けなかった理由
+		std::string error_;
+	};
+} /* namespace okl */
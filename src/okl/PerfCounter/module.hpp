@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "PerfCounter.hpp"
\ No newline at end of file
@@ -0,0 +1,114 @@
+﻿#pragma once
+
+#include "Population.hpp"
+#include "../Arena/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      連続領域母集団クラス
+	 *  @details    全個体の巡回路を1つの連続領域(Arena)にまとめて格納する母集団クラス
+	 *				個体ごとのブロックはキャッシュライン境界に揃え，個体番号順に並べる
+	 *				コストなどの個体の固定長部分は個体配列に連続して並ぶため，集団全体の走査はどちらも連続したメモリアクセスになる
+	 *				born関数とkill関数は個体番号を再利用するだけなので，世代交代でメモリ確保は行わない
+	 *				個体型のルート配列型はArenaVectorであること
+	 *				- __Individual			個体型
+	 *				- __MaxPopulationSize	最大母集団サイズ
+	 *				- __Individuals			個体配列型
+	 *				- __Set					ID集合型
+	 */
+	template<
+		class __Individual,
+		std::size_t __MaxPopulationSize,
+		class __Individuals = std::vector<__Individual>,
+		class __Set = okl::HashSet<typename __Individual::id_type>>
+		class ArenaPopulation : public Population<__Individual, __MaxPopulationSize, __Individuals, __Set>
+	{
+	public:
+		using base_type = Population<__Individual, __MaxPopulationSize, __Individuals, __Set>;
+		using individual_type = typename base_type::individual_type;
+		using individuals_type = typename base_type::individuals_type;
+		using set_type = typename base_type::set_type;
+		using id_type = typename base_type::id_type;
+		using key_type = typename base_type::key_type;
+		using size_type = typename base_type::size_type;
+		using arena_type = Arena<typename individual_type::route_container_type::value_type>;
+
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ArenaPopulation() = default;
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 * @detail				連続領域を複製し，複製した個体を新しい領域に結び付け直す
+		 */
+		ArenaPopulation(const ArenaPopulation& __other) : base_type(__other), arena_(__other.arena_)
+		{
+			this->bind();
+		}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ArenaPopulation() = default;
+
+		/*!
+		 * @brief			代入処理を行う
+		 * @param[in]		__other 代入元対象
+		 * @return			ArenaPopulation&	自分自身の参照を返す
+		 * @detail			連続領域の形が同じなら，各個体をブロック内に複製する
+		 */
+		ArenaPopulation& operator=(const ArenaPopulation& __other)
+		{
+			if (this->arena_.block_num() != __other.arena_.block_num() || this->arena_.block_size() != __other.arena_.block_size()) {
+				//連続領域を確保し直す前に，個体を結び付けていない状態に戻す
+				for (auto& _individual : this->individuals_) {
+					_individual.bindRoute(nullptr, 0);
+				}
+				this->arena_.resize(__other.arena_.block_num(), __other.arena_.block_size());
+				base_type::operator=(__other);
+				this->bind();
+			}
+			else {
+				base_type::operator=(__other);
+			}
+			return *this;
+		}
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			全個体の巡回路の連続領域を確保し，各個体を結び付けてから全要素のメモリ確保を行う
+		 */
+		inline void resize(const size_type __size)
+		{
+			this->arena_.resize(__MaxPopulationSize, __size);
+			this->individuals_.resize(__MaxPopulationSize);
+			this->bind();
+			base_type::resize(__size);
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	個体，番号集合と連続領域が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return base_type::memory_size() + okl::memorySize(this->arena_);
+		}
+
+	private:
+		//!全個体の巡回路の連続領域
+		arena_type arena_;
+
+		/*!
+		 * @brief			各個体を個体番号のブロックに結び付ける
+		 */
+		inline void bind()
+		{
+			for (std::size_t _index = 0; _index < this->individuals_.size() && _index < this->arena_.block_num(); ++_index) {
+				this->individuals_[_index].bindRoute(this->arena_.block(_index), static_cast<typename individual_type::size_type>(this->arena_.block_size()));
+			}
+		}
+	};
+} /* namespace okl */
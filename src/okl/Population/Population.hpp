@@ -83,9 +83,13 @@ namespace okl {
 			this->individuals_.resize(__MaxPopulationSize);
 			std::for_each(this->individuals_.begin(), this->individuals_.end(),
 				[__size](auto& _individual) {_individual.resize(__size); });
-			this->present_generation_.reserve(__size);
-			this->next_generation_.reserve(__size);
-			this->corpses_.reserve(__size);
+			//番号集合に入るのは個体IDなので，頂点数ではなく最大個体数分を確保する
+			this->present_generation_.reserve(__MaxPopulationSize);
+			this->next_generation_.reserve(__MaxPopulationSize);
+			this->corpses_.reserve(__MaxPopulationSize);
+			this->present_generation_.clear();
+			this->next_generation_.clear();
+			this->corpses_.clear();
 			for (id_type _individual_id = 0; _individual_id < static_cast<id_type>(__MaxPopulationSize); ++_individual_id) {
 				this->corpses_.insert(_individual_id);
 			}
@@ -210,6 +214,24 @@ namespace okl {
 			return this->individuals_[_individua_id];
 		}
 
+		/*!
+		 * @brief			新たな個体を指定数まとめて確保する
+		 * @param[in]		__num 確保する個体数
+		 * @param[out]		__individual_ids 確保した個体IDの追加先
+		 * @detail			新たな個体IDを指定数next_generationに移動しcorpsesから削除する
+		 *					確保後の個体はindividual関数で個体IDごとに並列に生成できる
+		 */
+		template<class __Ids>
+		inline void born(const size_type __num, __Ids& __individual_ids)
+		{
+			for (size_type _count = 0; _count < __num; ++_count) {
+				const auto _individua_id = this->corpses_.back();
+				this->corpses_.erase(_individua_id);
+				this->next_generation_.insert(_individua_id);
+				__individual_ids.push_back(_individua_id);
+			}
+		}
+
 		/*!
 		 * @brief			世代を進める
 		 * @detail			次世代(next_generation)の個体IDを現世代(present_generation)にすべて移動する
@@ -250,7 +272,16 @@ namespace okl {
 			this->advanceGeneration();
 		}
 
-	private:
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	個体と番号集合が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->individuals_) + okl::memorySize(this->present_generation_) + okl::memorySize(this->next_generation_) + okl::memorySize(this->corpses_);
+		}
+
+	protected:
 		//!解集団
 		individuals_type individuals_;
 
@@ -1,2 +1,3 @@
 ﻿#pragma once
-#include "Population.hpp"
\ No newline at end of file
+#include "Population.hpp"
+#include "ArenaPopulation.hpp"
\ No newline at end of file
@@ -0,0 +1,177 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+//OKL_PROFILEを定義すると探索の段階ごとの計測を有効にする
+//定義しなければ計測用のマクロとProfileOperatorは何も行わない
+#ifdef OKL_PROFILE
+#define OKL_PROFILE_ADD(__member, __value) (okl::Profile::local().__member += static_cast<std::uint_least64_t>(__value))
+#else
+#define OKL_PROFILE_ADD(__member, __value) ((void)0)
+#endif
+
+namespace okl {
+	/*!
+	 *  @brief      探索の段階ごとの計測値
+	 *  @details    ProfileOperatorで囲んだ段階ごとに呼び出し回数，実時間，CPU時間，
+	 *				評価した移動数，適用した移動数，解の複製回数を集計する
+	 *				移動数と解の複製回数はスレッドごとのカウンタに加算し，段階の前後の差分を段階に割り当てる
+	 */
+	class Profile
+	{
+	public:
+		//!段階 初期解生成
+		static constexpr std::size_t start = 0;
+		//!段階 局所探索
+		static constexpr std::size_t local_search = 1;
+		//!段階 再初期解生成
+		static constexpr std::size_t restart = 2;
+		//!段階 摂動
+		static constexpr std::size_t perturbation = 3;
+		//!段階 交叉
+		static constexpr std::size_t crossover = 4;
+		//!段階 突然変異
+		static constexpr std::size_t mutation = 5;
+		//!段階 選択
+		static constexpr std::size_t selection = 6;
+		//!段階数
+		static constexpr std::size_t phase_num = 7;
+
+		/*!
+		 *  @brief      計測値
+		 */
+		struct Counter
+		{
+			//!呼び出し回数
+			std::uint_least64_t calls_ = 0;
+			//!実時間[ns]
+			std::uint_least64_t wall_ns_ = 0;
+			//!CPU時間[ns]
+			std::uint_least64_t cpu_ns_ = 0;
+			//!評価した移動数
+			std::uint_least64_t evaluated_moves_ = 0;
+			//!適用した移動数
+			std::uint_least64_t applied_moves_ = 0;
+			//!解の複製回数
+			std::uint_least64_t solution_copies_ = 0;
+
+			inline Counter& operator+=(const Counter& __other)
+			{
+				this->calls_ += __other.calls_;
+				this->wall_ns_ += __other.wall_ns_;
+				this->cpu_ns_ += __other.cpu_ns_;
+				this->evaluated_moves_ += __other.evaluated_moves_;
+				this->applied_moves_ += __other.applied_moves_;
+				this->solution_copies_ += __other.solution_copies_;
+				return *this;
+			}
+
+			inline Counter operator-(const Counter& __other) const
+			{
+				Counter _counter;
+				_counter.calls_ = this->calls_ - __other.calls_;
+				_counter.wall_ns_ = this->wall_ns_ - __other.wall_ns_;
+				_counter.cpu_ns_ = this->cpu_ns_ - __other.cpu_ns_;
+				_counter.evaluated_moves_ = this->evaluated_moves_ - __other.evaluated_moves_;
+				_counter.applied_moves_ = this->applied_moves_ - __other.applied_moves_;
+				_counter.solution_copies_ = this->solution_copies_ - __other.solution_copies_;
+				return _counter;
+			}
+		};
+
+		/*!
+		 * @brief			スレッドごとのカウンタを返す
+		 * @return			Counter&	呼び出したスレッドのカウンタの参照を返す
+		 * @detail			移動数と解の複製回数をOKL_PROFILE_ADDマクロで加算する
+		 */
+		static Counter& local()
+		{
+			thread_local Counter _counter;
+			return _counter;
+		}
+
+		/*!
+		 * @brief			段階名を返す
+		 * @param[in]		__phase 段階
+		 * @return			const char*	段階名を返す
+		 */
+		static const char* phaseName(const std::size_t __phase)
+		{
+			static const char* const _names[phase_num] = { "Start", "LocalSearch", "ReStart", "Perturbation", "Crossover", "Mutation", "Selection" };
+			return __phase < phase_num ? _names[__phase] : "";
+		}
+
+		/*!
+		 * @brief			全要素初期化
+		 */
+		inline void clear()
+		{
+			this->counters_.fill(Counter());
+		}
+
+		/*!
+		 * @brief			段階の計測値を加算する
+		 * @param[in]		__phase 段階
+		 * @param[in]		__counter 計測値
+		 */
+		inline void add(const std::size_t __phase, const Counter& __counter)
+		{
+			this->counters_[__phase] += __counter;
+		}
+
+		/*!
+		 * @brief			計測値を統合する
+		 * @param[in]		__other 統合元
+		 * @detail			並列探索で各スレッドの計測値を集約するために用いる
+		 */
+		inline void merge(const Profile& __other)
+		{
+			for (std::size_t _phase = 0; _phase < phase_num; ++_phase) {
+				this->counters_[_phase] += __other.counters_[_phase];
+			}
+		}
+
+		/*!
+		 * @brief			段階の計測値を返す
+		 * @param[in]		__phase 段階
+		 * @return			const Counter&	計測値の参照を返す
+		 */
+		inline const Counter& counter(const std::size_t __phase) const
+		{
+			return this->counters_[__phase];
+		}
+
+		/*!
+		 * @brief			CSVの見出しを返す
+		 * @return			std::string	見出し行を返す
+		 */
+		static std::string header()
+		{
+			return "trial,phase,calls,wall_ns,cpu_ns,evaluated_moves,applied_moves,solution_copies\n";
+		}
+
+		/*!
+		 * @brief			計測値をCSVで書き込む
+		 * @param[out]		__out 出力ストリーム
+		 * @param[in]		__trial 試行番号
+		 * @detail			一度も呼び出されなかった段階は書き込まない
+		 */
+		inline void write(std::ostream& __out, const std::size_t __trial) const
+		{
+			for (std::size_t _phase = 0; _phase < phase_num; ++_phase) {
+				const auto& _counter = this->counters_[_phase];
+				if (_counter.calls_ != 0) {
+					__out << __trial << "," << phaseName(_phase) << "," << _counter.calls_ << "," << _counter.wall_ns_ << "," << _counter.cpu_ns_ << ","
+						<< _counter.evaluated_moves_ << "," << _counter.applied_moves_ << "," << _counter.solution_copies_ << "\n";
+				}
+			}
+		}
+
+	private:
+		//!段階ごとの計測値
+		std::array<Counter, phase_num> counters_;
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Profile.hpp"
\ No newline at end of file
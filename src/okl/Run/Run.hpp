@@ -2,10 +2,52 @@
 
 #include "../Timer/module.hpp"
 #include "../Random/module.hpp"
+#include "../Parallel/module.hpp"
+#include "../Scheduler/module.hpp"
+#include "../Checkpoint/module.hpp"
+#include "../ChromeTrace/module.hpp"
+#include "../MemorySize/module.hpp"
 #include <vector>
 #include <limits>
+#include <mutex>
+#include <condition_variable>
+#include <ostream>
 
 namespace okl {
+	/*!
+	 * @brief			試行の進捗を表示する
+	 * @param[in]		__search_info 探索情報クラス
+	 * @param[in]		__trial 試行番号
+	 * @detail			進捗表示名が設定されていれば，表示名と試行番号を1行で表示する
+	 *					設定されていなければ試行番号のみを続けて表示し，endProgress関数で改行する
+	 *					並行して解く問題例と出力が混ざらないよう，共有の出力ミューテックスを取得して表示する
+	 */
+	template<class __SearchInfo>
+	void writeProgress(const __SearchInfo& __search_info, const std::size_t __trial)
+	{
+		std::lock_guard<std::mutex> _output_lock(BatchScheduler::output_mutex());
+		if (__search_info.progress_name().empty()) {
+			std::cout << "-" << __trial << std::flush;
+		}
+		else {
+			std::cout << __search_info.progress_name() << "-" << __trial << std::endl;
+		}
+	}
+
+	/*!
+	 * @brief			試行の進捗表示を終える
+	 * @param[in]		__search_info 探索情報クラス
+	 * @detail			進捗表示名が設定されていなければ改行する
+	 */
+	template<class __SearchInfo>
+	void endProgress(const __SearchInfo& __search_info)
+	{
+		if (__search_info.progress_name().empty()) {
+			std::lock_guard<std::mutex> _output_lock(BatchScheduler::output_mutex());
+			std::cout << std::endl;
+		}
+	}
+
 	/*!
 	 * @brief			指定の試行回数探索を行う
 	 * @param[in]		__max_times 試行回数
@@ -14,29 +56,247 @@ namespace okl {
 	 * @param[in]		__search 探索クラス
 	 * @param[out]		__search_info 探索情報クラス
 	 * @param[out]		__solution 解クラス
+	 * @param[in,out]	__checkpoint チェックポイントクラス
 	 * @detail			指定の試行回数探索を行う
+	 *					チェックポイントを読み込んでいれば，保存時の次の試行から再開する
+	 *					保存間隔ごとの試行の後に，出力ファイルのフラッシュを待ってからチェックポイントを保存する
 	 */
 	template<class __Graph, class __Search, class __SearchInfo, class __Solution>
-	void run(const std::size_t __max_times, std::seed_seq::result_type __seed, __Graph& __graph, __Search& __search, __SearchInfo& __search_info, __Solution& __solution)
+	void run(const std::size_t __max_times, std::seed_seq::result_type __seed, __Graph& __graph, __Search& __search, __SearchInfo& __search_info, __Solution& __solution, Checkpoint& __checkpoint)
 	{
 		Random<> _seed_generator(__seed);
+		__checkpoint.setRun(__max_times, __seed);
+		__checkpoint.restoreEngine(_seed_generator.engin());
 
 		const auto _initial_solution = __solution;
 
-		for (std::size_t _times = 1; _times <= __max_times; _times++)
+		for (std::size_t _times = static_cast<std::size_t>(__checkpoint.next_trial()); _times <= __max_times; _times++)
 		{
-			std::cout << "-" << _times << std::flush;
+			writeProgress(__search_info, _times);
 			__search.clear();
 			__search_info.clear();
+			__solution.clear();
 			__solution = _initial_solution;
 			__search.seed(_seed_generator.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
 
+			__search_info.setTrial(_times);
+			OKL_TRACE_SCOPE("Trial", "", __search_info);
 			__search_info.startTime();
+			__search_info.startPerfCounter();
 
 			__search(__graph, __search_info, __solution);
+			__search_info.stopPerfCounter();
+			__search_info.endTrial();
 			__search_info.writeResult();
 			__search_info.writeLog();
+			__search_info.writeSolution(__solution);
+			__search_info.flush();
+
+			if (__checkpoint.isSaveTrial(_times)) {
+				__search_info.sync();
+				__checkpoint.save(_times + 1, Checkpoint::engineState(_seed_generator.engin()), __search_info.output_sizes());
+			}
+		}
+		endProgress(__search_info);
+	}
+
+	/*!
+	 * @brief			指定の試行回数探索を行う
+	 * @param[in]		__max_times 試行回数
+	 * @param[in]		__seed 初期シード
+	 * @param[in]		__graph グラフクラス
+	 * @param[in]		__search 探索クラス
+	 * @param[out]		__search_info 探索情報クラス
+	 * @param[out]		__solution 解クラス
+	 * @detail			指定の試行回数探索を行う
+	 */
+	template<class __Graph, class __Search, class __SearchInfo, class __Solution>
+	void run(const std::size_t __max_times, std::seed_seq::result_type __seed, __Graph& __graph, __Search& __search, __SearchInfo& __search_info, __Solution& __solution)
+	{
+		Checkpoint _checkpoint;
+		run(__max_times, __seed, __graph, __search, __search_info, __solution, _checkpoint);
+	}
+
+	/*!
+	 * @brief			指定の試行回数探索を並列に行う
+	 * @param[in]		__max_times 試行回数
+	 * @param[in]		__thread_num スレッド数 0ならハードウェアの並列数
+	 * @param[in]		__seed 初期シード
+	 * @param[in]		__graph グラフクラス
+	 * @param[in]		__search 探索クラス
+	 * @param[out]		__search_info 探索情報クラス
+	 * @param[out]		__solution 解クラス
+	 * @param[in,out]	__checkpoint チェックポイントクラス
+	 * @detail			各試行を独立に並列実行する
+	 *					各試行のシードは逐次実行時と同じ順で生成するため，試行ごとの結果は逐次実行と一致する
+	 *					結果とログと解は試行順にファイルに書き込む
+	 *					出力バッファはスレッド数の2倍の試行分のみ持ち，書き込み待ちの試行が埋まっている間は先の試行を開始しない
+	 *					__solutionには最終試行の解が格納される
+	 *					チェックポイントは試行順の書き込み時に保存するため，逐次実行時と同じ内容となる
+	 */
+	template<class __Graph, class __Search, class __SearchInfo, class __Solution>
+	void run(const std::size_t __max_times, const std::size_t __thread_num, std::seed_seq::result_type __seed, __Graph& __graph, __Search& __search, __SearchInfo& __search_info, __Solution& __solution, Checkpoint& __checkpoint)
+	{
+		__checkpoint.setRun(__max_times, __seed);
+		const auto _first_index = std::min(static_cast<std::size_t>(__checkpoint.next_trial() - 1), __max_times);
+		const auto _thread_num = std::min(threadNum(__thread_num), __max_times - _first_index);
+		if (_thread_num <= 1) {
+			run(__max_times, __seed, __graph, __search, __search_info, __solution, __checkpoint);
+			return;
 		}
-		std::cout << std::endl;
+
+		//チェックポイントを保存する試行の後の乱数エンジンの状態も記録する
+		Random<> _seed_generator(__seed);
+		__checkpoint.restoreEngine(_seed_generator.engin());
+		std::vector<std::seed_seq::result_type> _seeds(__max_times);
+		std::vector<Checkpoint::state_type> _engine_states(__max_times);
+		for (std::size_t _index = _first_index; _index < __max_times; ++_index) {
+			_seeds[_index] = _seed_generator.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max());
+			if (__checkpoint.isSaveTrial(_index + 1)) {
+				_engine_states[_index] = Checkpoint::engineState(_seed_generator.engin());
+			}
+		}
+
+		const auto _initial_solution = __solution;
+
+		//スレッドごとの探索クラス，探索情報クラス，解クラス
+		std::vector<__Search> _searches(_thread_num, __search);
+		std::vector<__SearchInfo> _search_infos(_thread_num);
+		for (auto& _search_info : _search_infos) {
+			_search_info.resize(static_cast<typename __SearchInfo::size_type>(__graph.vertices().size()));
+			_search_info.copyParameters(__search_info);
+		}
+		std::vector<__Solution> _solutions(_thread_num, _initial_solution);
+
+		//実行中と書き込み待ちの試行の出力バッファ 試行番号を窓の大きさで割った余りの位置を使う
+		//窓の先頭の試行は必ずいずれかのスレッドが実行中であるため，待っているスレッドは先頭の書き込みで必ず再開する
+		const auto _window_size = 2 * _thread_num;
+		std::vector<typename __SearchInfo::output_buffer_type> _buffers(_window_size);
+		std::vector<bool> _finished(_window_size, false);
+		std::size_t _next_write_index = _first_index;
+		std::mutex _write_mutex;
+		std::condition_variable _write_condition;
+
+		parallelFor(_thread_num, __max_times - _first_index, [&](const std::size_t __offset, const std::size_t __thread_id) {
+			const auto _index = _first_index + __offset;
+			auto& _buffer = _buffers[_index % _window_size];
+			{
+				std::unique_lock<std::mutex> _wait_lock(_write_mutex);
+				_write_condition.wait(_wait_lock, [&]() { return _index < _next_write_index + _window_size; });
+			}
+			auto& _search = _searches[__thread_id];
+			auto& _search_info = _search_infos[__thread_id];
+			auto& _solution = _solutions[__thread_id];
+
+			_search.clear();
+			_search_info.clear();
+			_solution.clear();
+			_solution = _initial_solution;
+			_search.seed(_seeds[_index]);
+
+			_search_info.setTrial(_index + 1);
+			OKL_TRACE_SCOPE("Trial", "", _search_info);
+			_search_info.startTime();
+			_search_info.startPerfCounter();
+
+			_search(__graph, _search_info, _solution);
+			_search_info.stopPerfCounter();
+			_search_info.endTrial();
+			_search_info.writeResult(_buffer);
+			_search_info.writeLog(_buffer);
+			_search_info.writeSolution(_buffer, _solution);
+			if (_index + 1 == __max_times) {
+				__solution = _solution;
+			}
+
+			//書き込み可能になった試行を試行順に書き込む
+			std::lock_guard<std::mutex> _lock(_write_mutex);
+			_finished[_index % _window_size] = true;
+			for (; _next_write_index < __max_times && _finished[_next_write_index % _window_size]; ++_next_write_index) {
+				writeProgress(__search_info, _next_write_index + 1);
+				auto& _write_buffer = _buffers[_next_write_index % _window_size];
+				__search_info.setTrial(_next_write_index + 1);
+				__search_info.writeOutput(_write_buffer);
+				_write_buffer = typename __SearchInfo::output_buffer_type();
+				_finished[_next_write_index % _window_size] = false;
+				__search_info.flush();
+
+				if (__checkpoint.isSaveTrial(_next_write_index + 1)) {
+					__search_info.sync();
+					__checkpoint.save(_next_write_index + 2, _engine_states[_next_write_index], __search_info.output_sizes());
+					_engine_states[_next_write_index] = Checkpoint::state_type();
+				}
+			}
+			_write_condition.notify_all();
+		});
+		endProgress(__search_info);
+	}
+
+	/*!
+	 * @brief			指定の試行回数探索を並列に行う
+	 * @param[in]		__max_times 試行回数
+	 * @param[in]		__thread_num スレッド数 0ならハードウェアの並列数
+	 * @param[in]		__seed 初期シード
+	 * @param[in]		__graph グラフクラス
+	 * @param[in]		__search 探索クラス
+	 * @param[out]		__search_info 探索情報クラス
+	 * @param[out]		__solution 解クラス
+	 * @detail			チェックポイントを用いずに各試行を独立に並列実行する
+	 */
+	template<class __Graph, class __Search, class __SearchInfo, class __Solution>
+	void run(const std::size_t __max_times, const std::size_t __thread_num, std::seed_seq::result_type __seed, __Graph& __graph, __Search& __search, __SearchInfo& __search_info, __Solution& __solution)
+	{
+		Checkpoint _checkpoint;
+		run(__max_times, __thread_num, __seed, __graph, __search, __search_info, __solution, _checkpoint);
+	}
+
+	/*!
+	 * @brief			探索中の最大メモリ量を見積もる
+	 * @param[in]		__max_times 試行回数
+	 * @param[in]		__thread_num スレッド数 0ならハードウェアの並列数
+	 * @param[in]		__graph_size グラフのメモリ量[byte]
+	 * @param[in]		__search 探索クラス
+	 * @param[in]		__search_info 探索情報クラス
+	 * @param[in]		__solution 解クラス
+	 * @return			std::size_t	探索中の最大メモリ量の予測値[byte]を返す
+	 * @detail			各クラスはresize後の状態で渡すこと
+	 *					並列実行時はスレッドごとに探索クラス，探索情報クラス，解クラスを複製するため，その分を加える
+	 *					ログの量など試行を進めるごとに増える領域は含まない
+	 */
+	template<class __Search, class __SearchInfo, class __Solution>
+	std::size_t peakMemorySize(const std::size_t __max_times, const std::size_t __thread_num, const std::size_t __graph_size, const __Search& __search, const __SearchInfo& __search_info, const __Solution& __solution)
+	{
+		const auto _search_size = sizeof(__Search) + okl::memorySize(__search);
+		const auto _search_info_size = sizeof(__SearchInfo) + okl::memorySize(__search_info);
+		const auto _solution_size = sizeof(__Solution) + okl::memorySize(__solution);
+		const auto _thread_num = std::min(threadNum(__thread_num), __max_times);
+
+		std::size_t _peak_size = __graph_size + _search_size + _search_info_size + _solution_size;
+		if (1 < _thread_num) {
+			//初期解の複製とスレッドごとの複製
+			_peak_size += _solution_size + _thread_num * (_search_size + _search_info_size + _solution_size);
+		}
+		return _peak_size;
+	}
+
+	/*!
+	 * @brief			探索に必要なメモリ量を構成要素ごとに書き込む
+	 * @param[out]		__os 出力ストリーム
+	 * @param[in]		__max_times 試行回数
+	 * @param[in]		__thread_num スレッド数 0ならハードウェアの並列数
+	 * @param[in]		__graph_size グラフのメモリ量[byte]
+	 * @param[in]		__search 探索クラス
+	 * @param[in]		__search_info 探索情報クラス
+	 * @param[in]		__solution 解クラス
+	 * @return			std::size_t	探索中の最大メモリ量の予測値[byte]を返す
+	 * @detail			最大メモリ量はpeakMemorySize関数で見積もる
+	 */
+	template<class __Search, class __SearchInfo, class __Solution>
+	std::size_t writeMemorySize(std::ostream& __os, const std::size_t __max_times, const std::size_t __thread_num, const std::size_t __graph_size, const __Search& __search, const __SearchInfo& __search_info, const __Solution& __solution)
+	{
+		const auto _peak_size = peakMemorySize(__max_times, __thread_num, __graph_size, __search, __search_info, __solution);
+		__os << "メモリ[byte]\tグラフ:" << __graph_size << "\t探索:" << sizeof(__Search) + okl::memorySize(__search) << "\t探索情報:" << sizeof(__SearchInfo) + okl::memorySize(__search_info)
+			<< "\t解:" << sizeof(__Solution) + okl::memorySize(__solution) << "\tスレッド数:" << std::min(threadNum(__thread_num), __max_times) << "\t最大:" << _peak_size << std::endl;
+		return _peak_size;
 	}
 } /* namespace okl */
\ No newline at end of file
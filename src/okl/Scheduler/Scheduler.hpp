@@ -0,0 +1,254 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "../Parallel/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      バッチ実行クラス
+	 *  @details    複数の処理をメモリ上限とスレッド数の範囲内で同時に実行する
+	 *				メモリ使用量の大きい処理から空きメモリに収まるものを順に開始し，小さい処理は詰めて同時に実行する
+	 *				各処理には残りの処理量に対する処理量の割合に応じたスレッド数を割り当てる
+	 *				処理は準備処理と本処理からなり，次に実行する処理の準備処理を先読み数だけバックグラウンドで先に行う
+	 */
+	class BatchScheduler {
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		BatchScheduler() : prefetch_num_(0) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~BatchScheduler() = default;
+
+		using size_type = std::size_t;
+		//!処理関数型 引数は割り当てスレッド数
+		using job_function_type = std::function<void(const size_type)>;
+		//!準備処理関数型
+		using prepare_function_type = std::function<void()>;
+
+		/*!
+		 * @brief			全要素初期化
+		 * @detail			登録された処理を全て削除する
+		 */
+		inline void clear()
+		{
+			this->jobs_.clear();
+		}
+
+		/*!
+		 * @brief			準備処理の先読み数を設定する
+		 * @param[in]		__prefetch_num 先読み数 0なら先読みしない
+		 * @detail			実行待ちの処理のうち，先頭から先読み数までの準備処理をバックグラウンドで先に行う
+		 *					先読みした処理のメモリ使用量は先読みの開始時点でメモリ上限に計上する
+		 */
+		inline void setPrefetchNum(const size_type __prefetch_num)
+		{
+			this->prefetch_num_ = __prefetch_num;
+		}
+
+		/*!
+		 * @brief			準備処理の先読み数を返す
+		 * @return			size_type	準備処理の先読み数を返す
+		 */
+		constexpr size_type prefetch_num() const
+		{
+			return this->prefetch_num_;
+		}
+
+		/*!
+		 * @brief			処理を登録する
+		 * @param[in]		__memory_size 処理の推定メモリ使用量[byte]
+		 * @param[in]		__work 処理の推定処理量 スレッド数の割り当てに用いる
+		 * @param[in]		__function 処理関数 __function(割り当てスレッド数)
+		 * @detail			準備処理のない処理を登録する
+		 *					処理はrun関数で実行される
+		 */
+		inline void addJob(const size_type __memory_size, const size_type __work, job_function_type __function)
+		{
+			this->addJob(__memory_size, __work, nullptr, std::move(__function));
+		}
+
+		/*!
+		 * @brief			処理を登録する
+		 * @param[in]		__memory_size 処理の推定メモリ使用量[byte]
+		 * @param[in]		__work 処理の推定処理量 スレッド数の割り当てに用いる
+		 * @param[in]		__prepare 準備処理関数 問題の読み込みなど　先読み時はバックグラウンドで実行される
+		 * @param[in]		__function 処理関数 __function(割り当てスレッド数) 準備処理の完了後に実行される
+		 * @detail			処理を登録する
+		 *					処理はrun関数で実行される
+		 *					処理の完了後に関数オブジェクトを破棄するため，キャプチャした資源はその時点で解放される
+		 */
+		inline void addJob(const size_type __memory_size, const size_type __work, prepare_function_type __prepare, job_function_type __function)
+		{
+			this->jobs_.push_back({ __memory_size, std::max<size_type>(__work, 1), std::move(__prepare), std::move(__function) });
+		}
+
+		/*!
+		 * @brief			処理間で共有する標準出力の排他制御を返す
+		 * @return			std::mutex&	標準出力への書き込みを排他するミューテックスを返す
+		 * @detail			同時に実行される処理は標準出力へ書き込む間ロックし，行が混ざらないようにする
+		 */
+		static std::mutex& output_mutex()
+		{
+			static std::mutex _output_mutex;
+			return _output_mutex;
+		}
+
+		/*!
+		 * @brief			登録された処理数を返す
+		 * @return			size_type	登録された処理数を返す
+		 */
+		inline size_type size() const
+		{
+			return this->jobs_.size();
+		}
+
+		/*!
+		 * @brief			登録された処理を全て実行する
+		 * @param[in]		__thread_num 全体のスレッド数 0ならハードウェアの並列数
+		 * @param[in]		__memory_budget 全体のメモリ上限[byte] 0なら上限なし
+		 * @detail			全ての処理が終わるまで戻らない
+		 *					スレッド数が1なら登録順に1つずつ実行する
+		 *					実行中の処理がない場合はメモリ上限を超える処理でも開始する
+		 *					処理中に送出された例外は全ての処理の終了後に再送出する
+		 */
+		void run(const size_type __thread_num, const size_type __memory_budget)
+		{
+			const auto _thread_num = threadNum(__thread_num);
+
+			//実行待ちの処理 複数スレッドならメモリ使用量の大きい順
+			std::vector<size_type> _order(this->jobs_.size());
+			std::iota(_order.begin(), _order.end(), 0);
+			if (_thread_num > 1) {
+				std::stable_sort(_order.begin(), _order.end(),
+					[this](const size_type __lhs, const size_type __rhs) { return this->jobs_[__lhs].memory_size_ > this->jobs_[__rhs].memory_size_; });
+			}
+
+			std::mutex _mutex;
+			std::condition_variable _condition;
+			std::exception_ptr _exception;
+			size_type _free_thread_num = _thread_num;
+			size_type _used_memory = 0;
+			size_type _running_num = 0;
+			size_type _pending_work = 0;
+			for (const auto& _job : this->jobs_) {
+				_pending_work += _job.work_;
+			}
+
+			//先読み中の準備処理
+			std::vector<std::future<void>> _prepared(this->jobs_.size());
+
+			const auto _fits = [&](const size_type __index) {
+				return __memory_budget == 0 || _used_memory + this->jobs_[__index].memory_size_ <= __memory_budget;
+			};
+
+			std::vector<std::thread> _threads;
+			_threads.reserve(this->jobs_.size());
+
+			std::unique_lock<std::mutex> _lock(_mutex);
+			while (!_order.empty()) {
+				//実行待ちの先頭から先読み数までの準備処理を開始する
+				const auto _prefetch_end = _order.begin() + static_cast<std::ptrdiff_t>(std::min(_order.size(), this->prefetch_num_));
+				for (auto _it = _order.begin(); _it != _prefetch_end; ++_it) {
+					if (!_prepared[*_it].valid() && _fits(*_it)) {
+						auto& _job = this->jobs_[*_it];
+						_used_memory += _job.memory_size_;
+						_prepared[*_it] = std::async(std::launch::async, _job.prepare_ ? std::move(_job.prepare_) : prepare_function_type([]() {}));
+					}
+				}
+
+				//先読み済みまたは空きメモリに収まる最大の処理を探す
+				auto _it = std::find_if(_order.begin(), _order.end(), [&](const size_type __index) {
+					return _prepared[__index].valid() || _fits(__index);
+				});
+				if (_it == _order.end() && _running_num == 0) {
+					_it = _order.begin();
+				}
+				if (_free_thread_num == 0 || _it == _order.end()) {
+					_condition.wait(_lock);
+					continue;
+				}
+
+				const auto _index = *_it;
+				const auto& _job = this->jobs_[_index];
+				const auto _share = static_cast<size_type>(static_cast<double>(_thread_num) * static_cast<double>(_job.work_) / static_cast<double>(_pending_work));
+				const auto _job_thread_num = std::clamp<size_type>(_share, 1, _free_thread_num);
+
+				if (!_prepared[_index].valid()) {
+					_used_memory += _job.memory_size_;
+				}
+				_free_thread_num -= _job_thread_num;
+				_pending_work -= _job.work_;
+				++_running_num;
+				_order.erase(_it);
+
+				_threads.emplace_back([&, _index, _job_thread_num]() {
+					auto& _running_job = this->jobs_[_index];
+					try {
+						if (_prepared[_index].valid()) {
+							_prepared[_index].get();
+						}
+						else if (_running_job.prepare_) {
+							_running_job.prepare_();
+						}
+						_running_job.function_(_job_thread_num);
+					}
+					catch (...) {
+						std::lock_guard<std::mutex> _exception_lock(_mutex);
+						if (!_exception) {
+							_exception = std::current_exception();
+						}
+					}
+					//キャプチャした資源を解放する
+					_running_job.prepare_ = nullptr;
+					_running_job.function_ = nullptr;
+
+					std::lock_guard<std::mutex> _finish_lock(_mutex);
+					_free_thread_num += _job_thread_num;
+					_used_memory -= _running_job.memory_size_;
+					--_running_num;
+					_condition.notify_all();
+				});
+			}
+			_lock.unlock();
+
+			for (auto& _thread : _threads) {
+				_thread.join();
+			}
+			if (_exception) {
+				std::rethrow_exception(_exception);
+			}
+		}
+
+	private:
+		/*!
+		 * @brief      処理情報
+		 */
+		struct Job {
+			//!推定メモリ使用量[byte]
+			size_type memory_size_;
+			//!推定処理量
+			size_type work_;
+			//!準備処理関数
+			prepare_function_type prepare_;
+			//!処理関数
+			job_function_type function_;
+		};
+
+		//!登録された処理
+		std::vector<Job> jobs_;
+		//!準備処理の先読み数
+		size_type prefetch_num_;
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Scheduler.hpp"
\ No newline at end of file
@@ -4,6 +4,41 @@
 #include "../../HashSet/module.hpp"
 
 namespace okl {
+	/*!
+	 *  @brief      移住なし関数クラス
+	 *  @details    遺伝的アルゴリズムの世代ごとの移住処理を行わない関数クラス
+	 */
+	class NoneMigrator
+	{
+	public:
+		/*!
+		 * @brief			移住処理
+		 * @return			bool	個体を受け入れたならTrue
+		 * @detail			何もしない
+		 */
+		template<class __Graph, class __SearchInfo, class __Population>
+		constexpr bool operator()(const __Graph& __graph, __SearchInfo& __search_info, __Population& __population) const
+		{
+			return false;
+		}
+
+		/*!
+		 * @brief			他の探索から停止が要求されたか判定する
+		 * @return			bool	停止が要求されたならTrue
+		 */
+		constexpr bool isStopped() const
+		{
+			return false;
+		}
+
+		/*!
+		 * @brief			他の探索に停止を要求する
+		 */
+		constexpr void stop() const
+		{
+		}
+	};
+
 	/*!
 	 *  @brief      局所探索関数クラス
 	 *  @details    局所探索関数クラス
@@ -100,19 +135,43 @@ namespace okl {
 		 */
 		template<class __SearchInfo>
 		void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
+		{
+			NoneMigrator _migrator;
+			(*this)(__graph, __search_info, __solution, _migrator);
+		}
+
+		/*!
+		 * @brief			移住処理付きでクラスに関連付けられた演算を実行
+		 * @param[in]		__graph グラフクラス
+		 * @param[out]		__search_info 探索情報クラス
+		 * @param[out]		__solution 解クラス 最良解が格納される
+		 * @param[out]		__migrator 移住処理クラス
+		 * @detail			世代ごとの選択後に移住処理を行う
+		 *					移住処理で個体を受け入れた場合は現世代で最良解を更新する
+		 *					終了条件を満たすか移住処理クラスに停止が要求されたら終了し，終了時に他の探索に停止を要求する
+		 */
+		template<class __SearchInfo, class __Migrator>
+		void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution, __Migrator& __migrator)
 		{
 			this->clear();
 			this->saveInitialSolution(__solution);
 			this->Start(__graph, __search_info);
 
-			while (!this->isEnd(__graph, __search_info, __solution))
+			while (!__migrator.isStopped() && !this->isEnd(__graph, __search_info, __solution))
 			{
 				this->Crossover(__graph, __search_info);
 
 				this->Mutation(__graph, __search_info);
 
 				this->Selection(__graph, __search_info);
+
+				if (__migrator(__graph, __search_info, this->population_)) {
+					this->upgradeBestIndividual(__search_info, this->population_.present_generation());
+				}
 			}
+			__migrator.stop();
+
+			this->loadBestSolution(__solution);
 		}
 
 		template<class __SearchInfo>
@@ -120,6 +179,15 @@ namespace okl {
 			(*this)(__graph, __search_info, __solution);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解と解集団，各演算が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<typename __Population::individual_type, __EndCondition>::memory_size() + okl::memorySize(this->population_) + okl::memorySize(this->crossover_) + okl::memorySize(this->mutation_) + okl::memorySize(this->selection_) + okl::memorySize(this->start_);
+		}
+
 	protected:
 		/*!
 		 * @brief			初期解生成
@@ -132,10 +200,9 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Start(graph_type& __graph, __SearchInfo& __search_info)
 		{
+			OKL_TRACE_SCOPE("Start", __Start::info(), __search_info);
 			this->start_(__graph, __search_info, this->population_, this->initial_solution_, this->best_solution_);
-			for (const auto _individual_id : this->population_.present_generation()) {
-				this->upgradeBestSolution(__search_info, this->population_.individual(_individual_id));
-			}
+			this->upgradeBestIndividual(__search_info, this->population_.present_generation());
 		}
 
 		/*!
@@ -149,10 +216,9 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Crossover(graph_type& __graph, __SearchInfo& __search_info)
 		{
+			OKL_TRACE_SCOPE("Crossover", __Crossover::info(), __search_info);
 			this->crossover_(__graph, __search_info, this->population_, this->initial_solution_, this->best_solution_);
-			for (const auto _individual_id : this->population_.next_generation()) {
-				this->upgradeBestSolution(__search_info, this->population_.individual(_individual_id));
-			}
+			this->upgradeBestIndividual(__search_info, this->population_.next_generation());
 		}
 
 		/*!
@@ -166,10 +232,9 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Mutation(graph_type& __graph, __SearchInfo& __search_info)
 		{
+			OKL_TRACE_SCOPE("Mutation", __Mutation::info(), __search_info);
 			this->mutation_(__graph, __search_info, this->population_, this->initial_solution_, this->best_solution_);
-			for (const auto _individual_id : this->population_.present_generation()) {
-				this->upgradeBestSolution(__search_info, this->population_.individual(_individual_id));
-			}
+			this->upgradeBestIndividual(__search_info, this->population_.present_generation());
 		}
 
 		/*!
@@ -183,9 +248,31 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Selection(graph_type& __graph, __SearchInfo& __search_info)
 		{
+			OKL_TRACE_SCOPE("Selection", __Selection::info(), __search_info);
 			this->selection_(__graph, __search_info, this->population_, this->initial_solution_, this->best_solution_);
 		}
 
+		/*!
+		 * @brief			個体群の最良個体が改善していればベスト解として保存
+		 * @param[out]		__search_info 探索情報クラス
+		 * @param[in]		__individual_ids 個体ID集合
+		 * @detail			個体群から最良の個体を選んでから最良解と比較するため，解の複製は高々1回になる
+		 */
+		template<class __SearchInfo, class __Ids>
+		inline void upgradeBestIndividual(__SearchInfo& __search_info, const __Ids& __individual_ids)
+		{
+			if (__individual_ids.isEmpty()) {
+				return;
+			}
+			auto _best_id = *__individual_ids.begin();
+			for (const auto _individual_id : __individual_ids) {
+				if (this->population_.individual(_best_id) < this->population_.individual(_individual_id)) {
+					_best_id = _individual_id;
+				}
+			}
+			this->upgradeBestSolution(__search_info, this->population_.individual(_best_id));
+		}
+
 	private:
 		//!母集団
 		__Population population_;
@@ -0,0 +1,349 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "../Search.hpp"
+#include "../../LockFreeQueue/module.hpp"
+#include "../../Parallel/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      島モデル遺伝的アルゴリズム関数クラス
+	 *  @details    島モデル遺伝的アルゴリズム関数クラス
+	 *				島ごとに遺伝的アルゴリズムを別スレッドで実行し，一定世代ごとに上位個体を移住させる
+	 *				移住は島の組ごとの有界ロックフリーキューを通して行い，キューが満杯なら移住個体は破棄する
+	 *				受け入れた個体は現世代の最悪個体より良い場合のみ最悪個体と入れ替える
+	 *				いずれかの島が終了条件を満たすと全ての島が終了する
+	 *				- __GeneticAlgorithm		遺伝的アルゴリズムクラス
+	 *				- __Topology				移住トポロジークラス
+	 *				- __IslandNum				島数 0ならハードウェアの並列数
+	 *				- __MigrationInterval		移住間隔世代数 1以上
+	 *				- __MigrationSize			1回の移住で送る個体数
+	 */
+	template<
+		class __GeneticAlgorithm,
+		class __Topology,
+		std::size_t __IslandNum = 0,
+		std::size_t __MigrationInterval = 10,
+		std::size_t __MigrationSize = 1>
+		class IslandGeneticAlgorithm : public Search<typename __GeneticAlgorithm::solution_type, typename __GeneticAlgorithm::end_condition_type>
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		IslandGeneticAlgorithm() : islands_(threadNum(__IslandNum))
+		{
+			const auto _island_num = this->islands_.size();
+			this->queues_.resize(_island_num * _island_num);
+			this->destinations_.resize(_island_num);
+			this->sources_.resize(_island_num);
+			for (std::size_t _island = 0; _island < _island_num; ++_island) {
+				this->destinations_[_island] = __Topology::destinations(_island, _island_num);
+				for (const auto _destination : this->destinations_[_island]) {
+					this->sources_[_destination].push_back(_island);
+				}
+			}
+		}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~IslandGeneticAlgorithm() = default;
+
+		using end_condition_type = typename __GeneticAlgorithm::end_condition_type;
+
+		using graph_type = typename Search<typename __GeneticAlgorithm::solution_type, end_condition_type>::graph_type;
+		using solution_type = typename Search<typename __GeneticAlgorithm::solution_type, end_condition_type>::solution_type;
+
+		using size_type = typename Search<solution_type, end_condition_type>::size_type;
+
+		using seed_type = typename  Search<solution_type, end_condition_type>::seed_type;
+		using random_device_type = typename Search<solution_type, end_condition_type>::random_device_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return "島モデル遺伝的アルゴリズム<" + __Topology::info() + ">(" + __GeneticAlgorithm::info() + ")"; }
+
+		/*!
+		 * @brief			全要素初期化
+		 * @detail			全要素を初期化処理を行う
+		 *					メモリ解放は行わない
+		 */
+		inline void clear() override
+		{
+			Search<solution_type, end_condition_type>::clear();
+			for (auto& _island : this->islands_) {
+				_island.clear();
+			}
+			for (auto& _queue : this->queues_) {
+				_queue.clear();
+			}
+		}
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			全要素をメモリ確保を行う
+		 *					移住用キューは解のメモリ確保を済ませた状態で確保する
+		 */
+		inline void resize(const size_type __size) override
+		{
+			Search<solution_type, end_condition_type>::resize(__size);
+			for (auto& _island : this->islands_) {
+				_island.resize(__size);
+			}
+
+			solution_type _solution;
+			_solution.resize(__size);
+			for (std::size_t _island = 0; _island < this->islands_.size(); ++_island) {
+				for (const auto _destination : this->destinations_[_island]) {
+					this->queue(_island, _destination).resize(__MigrationSize, _solution);
+				}
+			}
+		}
+
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定する
+		 * 					- seed_typeは標準ライブラリによって定義される
+		 */
+		inline void seed(const seed_type __seed) override
+		{
+			Search<solution_type, end_condition_type>::seed(__seed);
+			for (auto& _island : this->islands_) {
+				_island.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+			}
+		}
+
+		/*!
+		 * @brief			島数を返す
+		 * @return			size_type	島数を返す
+		 */
+		inline size_type island_num() const
+		{
+			return static_cast<size_type>(this->islands_.size());
+		}
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 *					各島の探索情報は探索終了後に__search_infoに統合する
+		 */
+		template<class __SearchInfo>
+		inline void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
+		{
+			this->clear();
+
+			this->saveInitialSolution(__solution);
+
+			const auto _island_num = this->islands_.size();
+
+			//島ごとの探索情報と解
+			std::vector<__SearchInfo> _search_infos(_island_num);
+			for (auto& _search_info : _search_infos) {
+				_search_info.resize(static_cast<typename __SearchInfo::size_type>(__graph.vertices().size()));
+				_search_info.copyParameters(__search_info);
+			}
+			std::vector<solution_type> _solutions(_island_num, __solution);
+
+			//終了フラグ
+			std::atomic<bool> _is_end(false);
+
+			parallelFor(_island_num, _island_num, [&](const std::size_t __index, const std::size_t __thread_id) {
+				//実時間の制限は共有し，CPU時間はこの島のスレッドで計測する
+				_search_infos[__index].syncTime(__search_info);
+				Migrator _migrator(*this, __index, _is_end, __solution);
+				this->islands_[__index](__graph, _search_infos[__index], _solutions[__index], _migrator);
+			});
+
+			for (const auto& _search_info : _search_infos) {
+				__search_info.merge(_search_info);
+			}
+			for (const auto& _solution : _solutions) {
+				this->upgradeBestSolution(__search_info, _solution);
+			}
+
+			this->loadBestSolution(__solution);
+		}
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __SearchInfo>
+		void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution, solution_type& __initial_solution, solution_type& __best_solution)
+		{
+			(*this)(__graph, __search_info, __solution);
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解と各島の遺伝的アルゴリズム，移住経路が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<typename __GeneticAlgorithm::solution_type, typename __GeneticAlgorithm::end_condition_type>::memory_size() + okl::memorySize(this->islands_) + okl::memorySize(this->destinations_) + okl::memorySize(this->sources_);
+		}
+
+	private:
+		/*!
+		 *  @brief      島ごとの移住処理関数クラス
+		 *  @details    遺伝的アルゴリズムから世代ごとに呼び出され，移住間隔ごとに移住個体の送信と受信を行う
+		 */
+		class Migrator
+		{
+		public:
+			/*!
+			 * @brief				コンストラクタ
+			 * @param[in]			__owner 島モデル遺伝的アルゴリズム
+			 * @param[in]			__island 島番号
+			 * @param[in]			__is_end 全ての島で共有する終了フラグ
+			 * @param[in]			__solution 受信用の解の複製元 メモリ確保済みの解を指定する
+			 */
+			Migrator(IslandGeneticAlgorithm& __owner, const std::size_t __island, std::atomic<bool>& __is_end, const solution_type& __solution) :
+				owner_(__owner), island_(__island), is_end_(__is_end), generation_(0), immigrant_(__solution) {}
+
+			/*!
+			 * @brief			移住処理
+			 * @param[in]		__graph グラフクラス
+			 * @param[out]		__search_info 探索情報クラス
+			 * @param[out]		__population 母集団クラス
+			 * @return			bool	個体を受け入れたならTrue
+			 * @detail			移住間隔ごとに現世代の上位個体を移住先に送り，移住元から届いた個体を受け入れる
+			 */
+			template<class __SearchInfo, class __Population>
+			bool operator()(const graph_type& __graph, __SearchInfo& __search_info, __Population& __population)
+			{
+				++this->generation_;
+				if (this->generation_ % __MigrationInterval != 0) {
+					return false;
+				}
+				this->emigrate(__population);
+				return this->immigrate(__population);
+			}
+
+			/*!
+			 * @brief			他の島から停止が要求されたか判定する
+			 * @return			bool	停止が要求されたならTrue
+			 */
+			inline bool isStopped() const
+			{
+				return this->is_end_.load(std::memory_order_relaxed);
+			}
+
+			/*!
+			 * @brief			他の島に停止を要求する
+			 */
+			inline void stop()
+			{
+				this->is_end_.store(true, std::memory_order_relaxed);
+			}
+
+		private:
+			//!島モデル遺伝的アルゴリズム
+			IslandGeneticAlgorithm& owner_;
+
+			//!島番号
+			std::size_t island_;
+
+			//!全ての島で共有する終了フラグ
+			std::atomic<bool>& is_end_;
+
+			//!世代数
+			std::size_t generation_;
+
+			//!受信用の解
+			solution_type immigrant_;
+
+			//!移住個体ID
+			std::vector<std::size_t> emigrants_;
+
+			/*!
+			 * @brief			現世代の上位個体を移住先に送る
+			 * @param[in]		__population 母集団クラス
+			 */
+			template<class __Population>
+			inline void emigrate(__Population& __population)
+			{
+				this->emigrants_.clear();
+				for (const auto _individual_id : __population.present_generation()) {
+					this->emigrants_.push_back(static_cast<std::size_t>(_individual_id));
+				}
+				const auto _emigrant_num = std::min(this->emigrants_.size(), __MigrationSize);
+				std::partial_sort(this->emigrants_.begin(), this->emigrants_.begin() + _emigrant_num, this->emigrants_.end(),
+					[&__population](const std::size_t __lhs, const std::size_t __rhs) {
+						return __population.individual(static_cast<typename __Population::key_type>(__rhs)) < __population.individual(static_cast<typename __Population::key_type>(__lhs));
+					});
+
+				for (const auto _destination : this->owner_.destinations_[this->island_]) {
+					auto& _queue = this->owner_.queue(this->island_, _destination);
+					for (std::size_t _index = 0; _index < _emigrant_num; ++_index) {
+						if (!_queue.push(__population.individual(static_cast<typename __Population::key_type>(this->emigrants_[_index])))) {
+							break;
+						}
+					}
+				}
+			}
+
+			/*!
+			 * @brief			移住元から届いた個体を受け入れる
+			 * @param[out]		__population 母集団クラス
+			 * @return			bool	個体を受け入れたならTrue
+			 */
+			template<class __Population>
+			inline bool immigrate(__Population& __population)
+			{
+				bool _is_immigrated = false;
+				for (const auto _source : this->owner_.sources_[this->island_]) {
+					auto& _queue = this->owner_.queue(_source, this->island_);
+					while (_queue.pop(this->immigrant_)) {
+						if (__population.present_generation().isEmpty()) {
+							continue;
+						}
+						auto _worst_id = *__population.present_generation().begin();
+						for (const auto _individual_id : __population.present_generation()) {
+							if (__population.individual(_individual_id) < __population.individual(_worst_id)) {
+								_worst_id = _individual_id;
+							}
+						}
+						if (__population.individual(_worst_id) < this->immigrant_) {
+							__population.kill(_worst_id);
+							__population.born() = this->immigrant_;
+							__population.advanceGeneration();
+							_is_immigrated = true;
+						}
+					}
+				}
+				return _is_immigrated;
+			}
+		};
+
+		//!島ごとの遺伝的アルゴリズム
+		std::vector<__GeneticAlgorithm> islands_;
+
+		//!移住用キュー 移住元×島数+移住先
+		std::vector<LockFreeQueue<solution_type>> queues_;
+
+		//!島ごとの移住先
+		std::vector<std::vector<std::size_t>> destinations_;
+
+		//!島ごとの移住元
+		std::vector<std::vector<std::size_t>> sources_;
+
+		/*!
+		 * @brief			移住用キューを返す
+		 * @param[in]		__source 移住元の島番号
+		 * @param[in]		__destination 移住先の島番号
+		 * @return			LockFreeQueue&	移住用キューの参照を返す
+		 */
+		inline LockFreeQueue<solution_type>& queue(const std::size_t __source, const std::size_t __destination)
+		{
+			return this->queues_[__source * this->islands_.size() + __destination];
+		}
+	};
+} /* namespace okl */
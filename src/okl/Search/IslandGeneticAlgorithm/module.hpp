@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "IslandGeneticAlgorithm.hpp"
\ No newline at end of file
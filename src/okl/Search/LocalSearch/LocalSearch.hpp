@@ -83,6 +83,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("LocalSearchLoop", info(), __search_info);
 			this->clear();
 
 			//this->saveInitialSolution(__solution);
@@ -103,6 +104,15 @@ namespace okl {
 			(*this)(__graph, __search_info, __solution);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解と近傍操作が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<__Solution, __EndCondition>::memory_size() + okl::memorySize(this->move_operator_);
+		}
+
 	protected:
 		/*!
 		 * @brief			近傍移動
@@ -117,6 +127,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void MovePhase(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("Move", __MoveOperator::info(), __search_info);
 			this->move_operator_(__graph, __search_info, __solution, this->initial_solution_, this->best_solution_);
 			//std::cout << "--ムーブ-----" + __MoveOperator::info() << std::endl;
 			//std::cout << __solution << std::endl;
@@ -122,6 +122,15 @@ namespace okl {
 			(*this)(__graph, __search_info, __solution);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解と局所探索，初期解生成が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<typename __LocalSearch::solution_type, __EndCondition>::memory_size() + okl::memorySize(this->local_search_) + okl::memorySize(this->start_) + okl::memorySize(this->restart_);
+		}
+
 	protected:
 		/*!
 		 * @brief			局所探索
@@ -136,6 +145,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void LocalSearch(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("LocalSearch", __LocalSearch::info(), __search_info);
 			this->local_search_(__graph, __search_info, __solution);
 			this->upgradeBestSolution(__search_info, __solution);
 			//std::cout << "--局所探索後-----" + __LocalSearch::info() << std::endl;
@@ -156,6 +166,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Start(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("Start", __Start::info(), __search_info);
 			//std::cout << "--初期解生成前-----" + __Start::info() << std::endl;
 			//std::cout << __solution << std::endl;
 			//std::cout << "-------" << std::endl;
@@ -178,6 +189,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void ReStart(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("ReStart", __ReStart::info(), __search_info);
 			this->restart_(__graph, __search_info, __solution, this->initial_solution_, this->best_solution_);
 			//std::cout << "--再初期解生成後-----" + __Start::info() << std::endl;
 			//std::cout << __solution << std::endl;
@@ -0,0 +1,248 @@
+﻿#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "../Search.hpp"
+#include "../../Parallel/module.hpp"
+
+namespace okl {
+	/*!
+	 *  @brief      並列多スタート局所探索関数クラス
+	 *  @details    並列多スタート局所探索関数クラス
+	 *				各スレッドで初期解生成と局所探索を独立に繰り返し，改善解を共有の最良解に反映する
+	 *				最良解のコストは排他制御なしで比較し，改善した場合のみ排他制御下で解を複製する
+	 *				終了条件は各局所探索の後に共有の探索情報と最良解で判定し，いずれかのスレッドで満たせば全スレッドが終了する
+	 *				局所探索の回数で終了する場合，判定時点で実行中の局所探索の分だけ回数が超過する
+	 *				- __LocalSearch				局所探索クラス
+	 *				- __Start					初期解生成クラス
+	 *				- __ReStart					再初期解生成クラス
+	 *				- __EndCondition			終了条件クラス
+	 *				- __ThreadNum				スレッド数 0ならハードウェアの並列数
+	 */
+	template<
+		class __LocalSearch,
+		class __Start,
+		class __ReStart,
+		class __EndCondition,
+		std::size_t __ThreadNum = 0>
+		class ParallelMultiStartLocalSearch : public Search<typename __LocalSearch::solution_type, __EndCondition>
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		ParallelMultiStartLocalSearch() : workers_(threadNum(__ThreadNum)) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~ParallelMultiStartLocalSearch() = default;
+
+		using graph_type = typename Search<typename __LocalSearch::solution_type, __EndCondition>::graph_type;
+		using solution_type = typename Search<typename __LocalSearch::solution_type, __EndCondition>::solution_type;
+
+		using size_type = typename Search<typename __LocalSearch::solution_type, __EndCondition>::size_type;
+
+		using seed_type = typename  Search<solution_type, __EndCondition>::seed_type;
+		using random_device_type = typename Search<solution_type, __EndCondition>::random_device_type;
+
+		using cost_type = typename solution_type::cost_type;
+		using cost_comparison_function = typename solution_type::cost_comparison_function;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return "並列多スタート局所探索法<" + __EndCondition::info() + ">(" + __LocalSearch::info() + ")(" + __Start::info() + ")(" + __ReStart::info() + ")"; }
+
+		/*!
+		 * @brief			全要素初期化
+		 * @detail			全要素を初期化処理を行う
+		 *					メモリ解放は行わない
+		 */
+		inline void clear() override
+		{
+			Search<solution_type, __EndCondition>::clear();
+			for (auto& _worker : this->workers_) {
+				_worker.local_search_.clear();
+				_worker.start_.clear();
+				_worker.restart_.clear();
+				_worker.solution_.clear();
+				_worker.best_solution_.invalidate();
+			}
+		}
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			全要素をメモリ確保を行う
+		 */
+		inline void resize(const size_type __size) override
+		{
+			Search<solution_type, __EndCondition>::resize(__size);
+			for (auto& _worker : this->workers_) {
+				_worker.local_search_.resize(__size);
+				_worker.start_.resize(__size);
+				_worker.restart_.resize(__size);
+				_worker.solution_.resize(__size);
+				_worker.best_solution_.resize(__size);
+			}
+		}
+
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定する
+		 * 					- seed_typeは標準ライブラリによって定義される
+		 */
+		inline void seed(const seed_type __seed) override
+		{
+			Search<solution_type, __EndCondition>::seed(__seed);
+			for (auto& _worker : this->workers_) {
+				_worker.local_search_.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+				_worker.start_.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+				_worker.restart_.seed(this->random_device_.uniform_int(std::numeric_limits < std::seed_seq::result_type >::min(), std::numeric_limits < std::seed_seq::result_type >::max()));
+			}
+		}
+
+		/*!
+		 * @brief			スレッド数を返す
+		 * @return			size_type	スレッド数を返す
+		 */
+		inline size_type thread_num() const
+		{
+			return static_cast<size_type>(this->workers_.size());
+		}
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 *					各スレッドの探索情報は探索終了後に__search_infoに統合する
+		 */
+		template<class __SearchInfo>
+		inline void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
+		{
+			this->clear();
+
+			this->saveInitialSolution(__solution);
+
+			//スレッドごとの探索情報
+			std::vector<__SearchInfo> _search_infos(this->workers_.size());
+			for (auto& _search_info : _search_infos) {
+				_search_info.resize(static_cast<typename __SearchInfo::size_type>(__graph.vertices().size()));
+				_search_info.copyParameters(__search_info);
+			}
+			for (auto& _worker : this->workers_) {
+				_worker.solution_ = __solution;
+			}
+
+			//共有の最良解のコスト
+			std::atomic<cost_type> _best_cost(this->best_solution_.cost());
+			//共有の最良解と終了条件の排他制御
+			std::mutex _mutex;
+			//終了フラグ
+			std::atomic<bool> _is_end(false);
+
+			parallelFor(this->workers_.size(), this->workers_.size(), [&](const std::size_t __index, const std::size_t __thread_id) {
+				auto& _worker = this->workers_[__index];
+				auto& _search_info = _search_infos[__index];
+				//実時間の制限は共有し，CPU時間はこのスレッドで計測する
+				_search_info.syncTime(__search_info);
+
+				_worker.start_(__graph, _search_info, _worker.solution_, this->initial_solution_, _worker.best_solution_);
+
+				while (true)
+				{
+					_worker.local_search_(__graph, _search_info, _worker.solution_);
+
+					//改善の可能性がある場合のみ排他制御下で最良解を更新する
+					if (cost_comparison_function()(_best_cost.load(std::memory_order_relaxed), _worker.solution_.cost())) {
+						std::lock_guard<std::mutex> _lock(_mutex);
+						if (this->upgradeBestSolution(__search_info, _worker.solution_)) {
+							_best_cost.store(this->best_solution_.cost(), std::memory_order_relaxed);
+						}
+					}
+
+					if (_is_end.load(std::memory_order_relaxed)) {
+						break;
+					}
+					//終了条件は共有の探索情報のタイマーの判定回数を書き換えるため，排他制御下で判定する
+					{
+						std::lock_guard<std::mutex> _lock(_mutex);
+						if (this->isEnd(__graph, __search_info, _worker.solution_)) {
+							_is_end.store(true, std::memory_order_relaxed);
+						}
+						//スレッドの最良解を共有の最良解に合わせる
+						else if (_worker.best_solution_ < this->best_solution_) {
+							_worker.best_solution_ = this->best_solution_;
+						}
+					}
+					if (_is_end.load(std::memory_order_relaxed)) {
+						break;
+					}
+
+					_worker.restart_(__graph, _search_info, _worker.solution_, this->initial_solution_, _worker.best_solution_);
+				}
+			});
+
+			for (const auto& _search_info : _search_infos) {
+				__search_info.merge(_search_info);
+			}
+
+			this->loadBestSolution(__solution);
+		}
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __SearchInfo>
+		void operator()(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution, solution_type& __initial_solution, solution_type& __best_solution)
+		{
+			(*this)(__graph, __search_info, __solution);
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解とスレッドごとの探索要素が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<typename __LocalSearch::solution_type, __EndCondition>::memory_size() + okl::memorySize(this->workers_);
+		}
+
+	private:
+		/*!
+		 * @brief      スレッドごとの探索要素
+		 */
+		struct Worker {
+			//!局所探索
+			__LocalSearch local_search_;
+
+			//!初期解生成
+			__Start start_;
+
+			//!再初期解生成
+			__ReStart restart_;
+
+			//!現在の解
+			solution_type solution_;
+
+			//!共有の最良解の複製
+			solution_type best_solution_;
+
+			/*!
+			 * @brief			確保しているメモリ量を返す
+			 * @return			std::size_t	探索要素が確保しているヒープ領域[byte]を返す
+			 */
+			inline std::size_t memory_size() const
+			{
+				return okl::memorySize(this->local_search_) + okl::memorySize(this->start_) + okl::memorySize(this->restart_) + okl::memorySize(this->solution_) + okl::memorySize(this->best_solution_);
+			}
+		};
+
+		//!スレッドごとの探索要素
+		std::vector<Worker> workers_;
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "ParallelMultiStartLocalSearch.hpp"
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "../Random/module.hpp"
 #include "../Result/module.hpp"
 #include "../Timer/module.hpp"
+#include "../ChromeTrace/module.hpp"
+#include "../MemorySize/module.hpp"
 
 #include <fstream>
 
@@ -35,6 +37,7 @@ namespace okl {
 
 		using seed_type = std::seed_seq::result_type;
 		using random_device_type = Random<>;
+		using end_condition_type = __EndCondition;
 
 		/*!
 		 * @brief			全要素初期化
@@ -43,8 +46,9 @@ namespace okl {
 		 */
 		virtual void clear()
 		{
-			this->initial_solution_.clear();
-			this->best_solution_.clear();
+			//初期解と最良解は次の代入で上書きされるため，コストのみ初期化する
+			this->initial_solution_.invalidate();
+			this->best_solution_.invalidate();
 			this->end_condition_.clear();
 		}
 
@@ -73,6 +77,15 @@ namespace okl {
 			this->end_condition_.seed(__seed);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解と最良解が確保しているヒープ領域[byte]を返す 派生クラスは保持する演算と解の領域を加える
+		 */
+		inline virtual std::size_t memory_size() const
+		{
+			return okl::memorySize(this->initial_solution_) + okl::memorySize(this->best_solution_);
+		}
+
 	protected:
 		//!乱数生成機
 		random_device_type random_device_;
@@ -105,6 +118,7 @@ namespace okl {
 		 * @param[in]		solution_type	 解クラス
 		 * @return			bool	解を更新したならTrue してないならFalse
 		 * @detail			解が改善していればベスト解として保存する
+		 *					探索情報クラスの最良の結果も更新したら改善を通知する
 		 * 					- search_info_typeはテンプレート__SearchInfoによって定義される
 		 * 					- solution_typeはテンプレート__Solutionによって定義される
 		 */
@@ -113,8 +127,8 @@ namespace okl {
 		{
 			if (this->best_solution_ < __solution) {
 				this->best_solution_ = __solution;
-				if (__solution.meetConstraints()) {
-					__search_info.setResult(__solution.cost());
+				if (__solution.meetConstraints() && __search_info.setResult(__solution.cost())) {
+					__search_info.notifyImprovement(__solution);
 				}
 				return true;
 			}
@@ -127,12 +141,13 @@ namespace okl {
 		 * @brief			最良解を現在の解に読み込む
 		 * @param[out]		__solution 現在の解
 		 * @detail			最良解を現在の解に読み込む
+		 *					探索の最後に呼び出すため，複製せずに交換する 交換後の最良解は元の現在の解となる
 		 * 					- solution_typeはテンプレート__Solutionによって定義される
 		 */
 		inline void loadBestSolution(solution_type& __solution)
 		{
 			if (__solution <= this->best_solution_) {
-				__solution = this->best_solution_;
+				__solution.swap(this->best_solution_);
 			}
 		}
 
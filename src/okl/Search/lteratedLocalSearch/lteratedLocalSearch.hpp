@@ -120,6 +120,15 @@ namespace okl {
 			(*this)(__graph, __search_info, __solution);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	初期解，最良解と局所探索，初期解生成，摂動が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const override
+		{
+			return Search<typename __LocalSearch::solution_type, __EndCondition>::memory_size() + okl::memorySize(this->local_search_) + okl::memorySize(this->start_) + okl::memorySize(this->perturbation_);
+		}
+
 	protected:
 		/*!
 		 * @brief			局所探索
@@ -134,6 +143,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void LocalSearch(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("LocalSearch", __LocalSearch::info(), __search_info);
 			this->local_search_(__graph, __search_info, __solution);
 			this->upgradeBestSolution(__search_info, __solution);
 			//std::cout << "--局所探索-----" + __LocalSearch::info() << std::endl;
@@ -154,6 +164,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Start(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("Start", __Start::info(), __search_info);
 			//std::cout << "--初期解生成前-----" + __Start::info() << std::endl;
 			//std::cout << __solution << std::endl;
 			//std::cout << "-------" << std::endl;
@@ -176,6 +187,7 @@ namespace okl {
 		template<class __SearchInfo>
 		inline void Perturbation(graph_type& __graph, __SearchInfo& __search_info, solution_type& __solution)
 		{
+			OKL_TRACE_SCOPE("Perturbation", __Perturbation::info(), __search_info);
 			this->perturbation_(__graph, __search_info, __solution, this->initial_solution_, this->best_solution_);
 			//std::cout << "--摂動-----" + __Perturbation::info() << std::endl;
 			//std::cout << __solution << std::endl;
@@ -2,5 +2,7 @@
 #include "Search.hpp"
 #include "LocalSearch/module.hpp"
 #include "MultiStartLocalSearch/module.hpp"
+#include "ParallelMultiStartLocalSearch/module.hpp"
 #include "lteratedLocalSearch/module.hpp"
-#include "GeneticAlgorithm/module.hpp"
\ No newline at end of file
+#include "GeneticAlgorithm/module.hpp"
+#include "IslandGeneticAlgorithm/module.hpp"
\ No newline at end of file
@@ -1,9 +1,18 @@
 ﻿#pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <unordered_map>
+#include "../AsyncWriter/module.hpp"
+#include "../BinaryTrace/module.hpp"
+#include "../ImprovementStream/module.hpp"
+#include "../Profile/module.hpp"
+#include "../PerfCounter/module.hpp"
 #include "../Timer/module.hpp"
 #include "../Result/module.hpp"
 
@@ -35,6 +44,12 @@ namespace okl {
 			this->pop_size_ = 0;
 			this->result_file_path_ = "";
 			this->log_file_path_ = "";
+			this->solution_file_path_ = "";
+			this->initial_solution_path_ = "";
+			this->trial_ = 0;
+			this->is_trace_output_ = false;
+			this->is_perf_counter_enabled_ = false;
+			this->is_perf_output_opened_ = false;
 
 			this->clear();
 		}
@@ -54,6 +69,14 @@ namespace okl {
 		using large_cost_type = std::size_t;
 		using mode_type = std::uint_least8_t;
 		using key_type = std::uint_least8_t;
+		//!バイナリ履歴型
+		using trace_type = BinaryTrace<info_type>;
+
+		//!改善イベント購読者型
+		using improvement_subscriber_type = ImprovementSubscriber<cost_type>;
+
+		//!出力バッファ型 結果, 履歴, カウントデータ, モード選択回数, モード平均コスト, バイナリ履歴, 解, 段階計測値, 性能カウンタ値の順
+		using output_buffer_type = std::array<std::ostringstream, 9>;
 
 		/*!
 		 * @brief			全要素初期化
@@ -66,6 +89,7 @@ namespace okl {
 			this->condition_monitoring_times_ = 0;
 			this->timer_.clear();
 			this->history_.clear();
+			this->trace_.clear();
 			this->best_result_.clear();
 			std::fill(this->counts_.begin(), this->counts_.end(), 0);
 			this->mode_ = std::numeric_limits<mode_type>::max();
@@ -74,6 +98,12 @@ namespace okl {
 			std::fill(this->modes_above_avg_count_.begin(), this->modes_above_avg_count_.end(), 0);
 			this->all_count_ = 0;
 			this->all_cost_sum_ = 0;
+			this->profile_.clear();
+			this->perf_trial_.fill(PerfCounter::unavailable);
+			for (auto& _values : this->perf_phases_) {
+				_values.fill(0);
+			}
+			this->perf_phase_calls_.fill(0);
 		}
 
 		/*!
@@ -105,16 +135,67 @@ namespace okl {
 		 */
 		constexpr time_type time() const
 		{
-			return this->timer_.template cpu_time< timer_type::seconds>();
+			return this->timer_.template time< timer_type::seconds>();
 		}
 
 		/*!
 		 * @brief			計測開始からのCPU時間を取得
-		 * @detail			計測開始からのCPU時間を取得する
+		 * @detail			計測開始からの計測開始したスレッドのCPU時間を取得する
 		 */
-		constexpr time_type cpu_time() const
+		inline time_type cpu_time() const
 		{
-			return this->timer_.template time< timer_type::seconds>();
+			return this->timer_.template cpu_time< timer_type::seconds>();
+		}
+
+		/*!
+		 * @brief			計測開始からの実時間が設定した実行時間以上か判定
+		 * @return			bool	実行時間以上ならTrue 実行時間が0ならFalse
+		 * @detail			時計は設定した判定間隔の呼び出しごとにのみ読む
+		 *					タイマーの判定回数を書き換えるため，複数のスレッドから共有する探索情報では排他制御の下で呼び出す
+		 * 					TimerCondition() で使用する
+		 */
+		inline bool isTimeOver() const
+		{
+			return this->run_time_ != 0 && this->timer_.isOver(this->run_time_);
+		}
+
+		/*!
+		 * @brief			実行時間の判定間隔を設定
+		 * @param[in]		__time_check_interval 判定間隔 isTimeOver関数の呼び出し何回ごとに時計を読むか
+		 * @detail			実行時間の判定間隔を設定する　clear関数では初期化されない
+		 */
+		inline void setTimeCheckInterval(const size_type __time_check_interval)
+		{
+			this->timer_.setCheckInterval(__time_check_interval);
+		}
+
+		/*!
+		 * @brief			履歴をバイナリ形式で記録するチャンクの行数を設定
+		 * @param[in]		__trace_chunk_size チャンクの行数 0ならテキスト形式で記録する
+		 * @detail			0以外なら履歴をBinaryTrace形式でチャンクごとに_log_.binへ書き込む　clear関数では初期化されない
+		 *					setLogOutputPath関数より前に設定する
+		 */
+		inline void setTraceChunkSize(const size_type __trace_chunk_size)
+		{
+			this->trace_.resize(static_cast<typename trace_type::size_type>(__trace_chunk_size));
+		}
+
+		/*!
+		 * @brief			履歴をバイナリ形式で記録するチャンクの行数を取得
+		 * @return			size_type	チャンクの行数を返す
+		 */
+		inline size_type trace_chunk_size() const
+		{
+			return this->trace_.chunk_size();
+		}
+
+		/*!
+		 * @brief			実行時間の判定間隔を取得
+		 * @return			size_type	実行時間の判定間隔を返す
+		 */
+		constexpr size_type time_check_interval() const
+		{
+			return this->timer_.check_interval();
 		}
 
 		/*!
@@ -187,21 +268,148 @@ namespace okl {
 		/*!
 		 * @brief			算出結果を設定
 		 * @param[in]		__cost 解の値
+		 * @return			bool	最良の結果を更新したらtrueを返す
 		 * @detail			算出結果を設定する
 		 * 					- 数値型cost_typeはテンプレート__Resultのcost_typeによって定義される
 		 */
-		inline virtual void setResult(const cost_type __cost)
+		inline virtual bool setResult(const cost_type __cost)
 		{
 			result_type _result;
-			_result.set(__cost, this->cpu_time());
-			if (__cost > 8062) {
-				std::cout << "ERROR_d" << std::endl;
-				char c; std::cin >> c;
-			}
+			_result.set(__cost, this->time());
 
 			if (this->best_result_ < _result) {
 				this->best_result_ = _result;
+				return true;
 			}
+			return false;
+		}
+
+		/*!
+		 * @brief			最良解の改善を通知する
+		 * @param[in]		__solution 改善後の解
+		 * @detail			改善イベントの購読者が登録されていれば，試行番号，解の値，経過時間を通知する
+		 *					CPU時間はタイマーを開始したスレッドから呼び出した場合のみ通知し，他のスレッドからは負の値にする
+		 *					購読者が解を必要とすれば解を文字列にして渡す
+		 *					setResult関数で最良の結果を更新したときに呼び出す
+		 */
+		template<class __Solution>
+		inline void notifyImprovement(const __Solution& __solution)
+		{
+			if (!this->improvement_subscriber_) {
+				return;
+			}
+			typename improvement_subscriber_type::event_type _event;
+			_event.trial_ = this->trial();
+			_event.cost_ = __solution.cost();
+			_event.time_ = static_cast<double>(this->time());
+			_event.cpu_time_ = this->timer_.isStartedThread() ? static_cast<double>(this->cpu_time()) : -1.0;
+			if (this->improvement_subscriber_->isSolutionRequired()) {
+				std::ostringstream _solution;
+				__solution.write(_solution, this->improvement_subscriber_->name() + "_" + std::to_string(this->trial()));
+				_event.solution_ = _solution.str();
+			}
+			this->improvement_subscriber_->notify(_event);
+		}
+
+		/*!
+		 * @brief			改善イベントの購読者を設定する
+		 * @param[in]		__subscriber 購読者 nullptrなら通知しない
+		 * @detail			購読者はcopyParameters関数で複製した探索情報クラスと共有する　clear関数では初期化されない
+		 */
+		inline void setImprovementSubscriber(const std::shared_ptr<improvement_subscriber_type>& __subscriber)
+		{
+			this->improvement_subscriber_ = __subscriber;
+		}
+
+		/*!
+		 * @brief			試行の終了を通知する
+		 * @detail			改善イベントの購読者が登録されていれば，試行ごとに保持している情報を捨てさせる
+		 */
+		inline void endTrial()
+		{
+			if (this->improvement_subscriber_) {
+				this->improvement_subscriber_->endTrial(this->trial());
+			}
+		}
+
+		/*!
+		 * @brief			段階ごとの計測値を返す
+		 * @return			Profile&	計測値の参照を返す
+		 * @detail			ProfileOperatorが加算する　OKL_PROFILEが定義されていなければ常に空
+		 */
+		inline Profile& profile()
+		{
+			return this->profile_;
+		}
+
+		/*!
+		 * @brief			性能カウンタによる計測を設定
+		 * @param[in]		__is_enabled trueなら試行とPerfCounterOperatorで囲んだ段階の性能カウンタ値を結果の_perf_.csvに書き込む
+		 * @detail			clear関数では初期化されない
+		 */
+		inline void setPerfCounterEnabled(const bool __is_enabled)
+		{
+			this->is_perf_counter_enabled_ = __is_enabled;
+		}
+
+		/*!
+		 * @brief			性能カウンタによる計測を行うか
+		 * @return			bool	計測を行うならtrueを返す
+		 */
+		inline bool isPerfCounterEnabled() const
+		{
+			return this->is_perf_counter_enabled_;
+		}
+
+		/*!
+		 * @brief			呼び出したスレッドの性能カウンタの現在値を返す
+		 * @return			PerfCounter::values_type	累計値を返す
+		 * @detail			最初の呼び出しでカウンタを開くため，常に同じスレッドから呼び出す
+		 *					開けなければ一度だけ理由を標準エラー出力に書き込み，以降はunavailableを返す
+		 */
+		inline PerfCounter::values_type readPerfCounter()
+		{
+			static std::atomic<bool> _is_warned(false);
+			if (!this->perf_counter_.open() || !this->perf_counter_.error().empty()) {
+				if (!_is_warned.exchange(true)) {
+					std::cerr << "perf counter unavailable (" << this->perf_counter_.error() << ")" << std::endl;
+				}
+			}
+			return this->perf_counter_.read();
+		}
+
+		/*!
+		 * @brief			試行の性能カウンタ計測を開始する
+		 * @detail			試行を実行するスレッドで探索の直前に呼び出す　計測が無効なら何もしない
+		 *					計測するのは呼び出したスレッドのみで，探索内部で起動したスレッドは含まない
+		 */
+		inline void startPerfCounter()
+		{
+			if (this->is_perf_counter_enabled_) {
+				this->perf_trial_begin_ = this->readPerfCounter();
+			}
+		}
+
+		/*!
+		 * @brief			試行の性能カウンタ計測を終了する
+		 * @detail			startPerfCounter関数と同じスレッドで探索の直後に呼び出す
+		 */
+		inline void stopPerfCounter()
+		{
+			if (this->is_perf_counter_enabled_) {
+				this->perf_trial_ = PerfCounter::difference(this->perf_trial_begin_, this->readPerfCounter());
+			}
+		}
+
+		/*!
+		 * @brief			段階の性能カウンタ値を加算する
+		 * @param[in]		__phase 段階 Profile::local_searchなど
+		 * @param[in]		__values 段階の計測値
+		 */
+		inline void addPerfCounter(const std::size_t __phase, const PerfCounter::values_type& __values)
+		{
+			PerfCounter::add(this->perf_phases_[__phase], __values);
+			++this->perf_phase_calls_[__phase];
 		}
 
 		/*!
@@ -290,6 +498,11 @@ namespace okl {
 		 */
 		inline void setInfo(const info_type& __info)
 		{
+			if (this->trace_chunk_size() != 0) {
+				this->trace_.push(__info);
+				this->writeTrace();
+				return;
+			}
 			this->history_.push_back(__info);
 		}
 
@@ -324,6 +537,63 @@ namespace okl {
 			this->pop_size_ = __size;
 		}
 
+		/*!
+		 * @brief			進捗表示名を取得
+		 * @return			std::string&	進捗表示名を返す 空なら進捗を行に分けずに表示する
+		 */
+		inline const std::string& progress_name() const
+		{
+			return this->progress_name_;
+		}
+
+		/*!
+		 * @brief			進捗表示名を設定
+		 * @param[in]		__name 進捗表示名 問題例名など
+		 * @detail			設定すると試行ごとの進捗を表示名付きの1行で表示し，並行して解く問題例の進捗が混ざらないようにする
+		 */
+		inline void setProgressName(const std::string& __name)
+		{
+			this->progress_name_ = __name;
+		}
+
+		/*!
+		 * @brief			試行番号を取得
+		 * @return			size_type	試行番号を返す
+		 */
+		constexpr size_type trial() const
+		{
+			return this->trial_;
+		}
+
+		/*!
+		 * @brief			試行番号を設定
+		 * @param[in]		__trial 試行番号 1始まり
+		 * @detail			解のファイル名に用いる　clear関数では初期化されない
+		 */
+		inline void setTrial(const size_type __trial)
+		{
+			this->trial_ = __trial;
+		}
+
+		/*!
+		 * @brief			初期解ファイルパスを取得
+		 * @return			std::string	初期解ファイルパスを返す 指定がなければ空文字列
+		 */
+		inline const std::string& initial_solution_path() const
+		{
+			return this->initial_solution_path_;
+		}
+
+		/*!
+		 * @brief			初期解ファイルパスを設定
+		 * @param[in]		__path 初期解ファイルパス
+		 * @detail			初期解をファイルから読み込む演算子が用いる　clear関数では初期化されない
+		 */
+		inline void setInitialSolutionPath(const std::string& __path)
+		{
+			this->initial_solution_path_ = __path;
+		}
+
 		/*!
 		 * @brief			実行時間を取得
 		 * @detail			実行時間を取得する
@@ -475,7 +745,18 @@ namespace okl {
 		inline void setResultOutputPath(const std::string __path)
 		{
 			this->result_file_path_ = __path;
-			this->result_out_.open(__path + ".csv");
+			this->openOutput(0, __path + ".csv");
+		}
+
+		/*!
+		 * @brief			解をファイルに書き込むパスを設定する
+		 * @param[in]		__path ファイルパス 空文字列なら書き込まない
+		 * @detail			試行ごとに最良解を__path_試行番号.tourに書き込む
+		 *					例:/path/path/aaa		aaa_1.tourとなる
+		 */
+		inline void setSolutionOutputPath(const std::string& __path)
+		{
+			this->solution_file_path_ = __path;
 		}
 
 		/*!
@@ -487,26 +768,69 @@ namespace okl {
 		inline virtual void setLogOutputPath(const std::string __path)
 		{
 			this->log_file_path_ = __path;
-			this->history_out_.open(__path + "_log_.csv");
-			this->count_data_out_.open(__path + "_count_.csv");
-			this->mode_count_out_.open(__path + "_mode_count_.csv");
-			this->mode_cost_avg_out_.open(__path + "_mode_cost_avg_.csv");
+			this->openLogFiles();
 		}
 
 		/*!
 		 * @brief			ログをすべて閉じる
-		 * @detail			ログファイルをすべて閉じる
+		 * @detail			書き込み待ちの内容を全て書き込み，ログファイルをすべて閉じる
 		 */
 		inline virtual void closeLogFiles()
 		{
-			this->result_out_.close();
-			this->history_out_.close();
-			this->count_data_out_.close();
-			this->mode_count_out_.close();
-			this->mode_cost_avg_out_.close();
+			this->writer_.close();
+		}
+
+		/*!
+		 * @brief			ログをフラッシュする
+		 * @detail			それまでに書き込んだ結果とログのフラッシュを要求する
+		 *					試行や問題の区切りで呼び出す　フラッシュの完了は待たない
+		 */
+		inline void flush()
+		{
+			this->writer_.flush();
 		}
 
 
+		/*!
+		 * @brief			出力ファイルへの書き込みを完了させる
+		 * @detail			それまでに書き込んだ結果とログと改善イベントのフラッシュが完了するまで待つ
+		 *					チェックポイントの保存前に呼び出す
+		 */
+		inline void sync()
+		{
+			this->writer_.sync();
+			if (this->improvement_subscriber_) {
+				this->improvement_subscriber_->sync();
+			}
+		}
+
+		/*!
+		 * @brief			出力ファイルサイズを返す
+		 * @return			std::vector<std::uint64_t>	結果とログの出力ファイルサイズを出力バッファと同じ順に返す 解の位置は使わない
+		 *					末尾には改善イベントの購読者の出力ファイルサイズを加える 購読者がなければ0
+		 * @detail			sync関数の後に呼び出す
+		 */
+		inline std::vector<std::uint64_t> output_sizes() const
+		{
+			std::vector<std::uint64_t> _sizes(std::tuple_size<output_buffer_type>::value + 1);
+			for (std::size_t _channel = 0; _channel < std::tuple_size<output_buffer_type>::value; ++_channel) {
+				_sizes[_channel] = static_cast<std::uint64_t>(this->writer_.size(_channel));
+			}
+			_sizes.back() = this->improvement_subscriber_ ? this->improvement_subscriber_->output_size() : 0;
+			return _sizes;
+		}
+
+		/*!
+		 * @brief			出力ファイルを指定サイズから再開するよう設定する
+		 * @param[in]		__sizes output_sizes関数で保存した出力ファイルサイズ
+		 * @detail			以降に開く出力ファイルを，保存時のサイズに切り詰めて追記するように開く
+		 *					setResultOutputPath関数，setLogOutputPath関数より前に呼び出す
+		 */
+		inline void resumeOutput(const std::vector<std::uint64_t>& __sizes)
+		{
+			this->resume_output_sizes_ = __sizes;
+		}
+
 		/*!
 		 * @brief			ログを再オープンする
 		 * @detail			ログファイルをすべて閉じ再オープンする
@@ -514,34 +838,128 @@ namespace okl {
 		inline virtual void reopenLogFiles() 
 		{
 			this->closeLogFiles();
-			this->result_out_.open(this->result_file_path_ + ".csv");
-			this->history_out_.open(this->log_file_path_ + "_log_.csv");
-			this->count_data_out_.open(this->log_file_path_ + "_count_.csv");
-			this->mode_count_out_.open(this->log_file_path_ + "_mode_count_.csv");
-			this->mode_cost_avg_out_.open(this->log_file_path_ + "_mode_cost_avg_.csv");
+			this->openOutput(0, this->result_file_path_ + ".csv");
+			this->openLogFiles();
 		}
 
 		/*!
 		 * @brief			結果をファイルに書き込む
-		 * @detail			結果をファイルに書き込む
+		 * @detail			結果を文字列にしてから書き込みスレッドに渡す
 		 */
 		inline void writeResult()
 		{
-			const auto _cpu_time = this->cpu_time();
-			this->result_out_ << this->best_result() << ", " << _cpu_time << std::endl;
+			output_buffer_type _buffer;
+			this->writeResult(_buffer);
+			this->writeOutput(_buffer);
+		}
+
+		/*!
+		 * @brief			結果を出力ストリームに書き込む
+		 * @param[out]		__result_out 結果出力ストリーム
+		 * @detail			結果を指定の出力ストリームに書き込む
+		 */
+		inline void writeResult(std::ostream& __result_out)
+		{
+			const auto _time = this->time();
+			__result_out << this->best_result() << ", " << _time << std::endl;
+		}
+
+		/*!
+		 * @brief			結果を出力バッファに書き込む
+		 * @param[out]		__buffer 出力バッファ
+		 * @detail			結果をファイルではなく出力バッファに書き込む
+		 *					writeOutput() でファイルに書き込む
+		 */
+		inline void writeResult(output_buffer_type& __buffer)
+		{
+			this->writeResult(__buffer[0]);
+			if (this->is_perf_counter_enabled_ && this->perf_counter_.isAvailable()) {
+				this->writePerfCounter(__buffer[8], "Trial", this->perf_trial_);
+				for (std::size_t _phase = 0; _phase < Profile::phase_num; ++_phase) {
+					if (this->perf_phase_calls_[_phase] != 0) {
+						this->writePerfCounter(__buffer[8], Profile::phaseName(_phase), this->perf_phases_[_phase]);
+					}
+				}
+			}
+		}
+
+		/*!
+		 * @brief			解をファイルに書き込む
+		 * @param[in]		__solution 解クラス
+		 * @detail			解の書き込み先が設定されていれば，解を文字列にしてから書き込みスレッドに渡す
+		 */
+		template<class __Solution>
+		inline void writeSolution(const __Solution& __solution)
+		{
+			output_buffer_type _buffer;
+			this->writeSolution(_buffer, __solution);
+			this->writeOutput(_buffer);
+		}
+
+		/*!
+		 * @brief			解を出力バッファに書き込む
+		 * @param[out]		__buffer 出力バッファ
+		 * @param[in]		__solution 解クラス
+		 * @detail			解の書き込み先が設定されていれば，解をファイルではなく出力バッファに書き込む
+		 *					解の名前はファイル名_試行番号とする
+		 *					writeOutput() でファイルに書き込む
+		 */
+		template<class __Solution>
+		inline void writeSolution(output_buffer_type& __buffer, const __Solution& __solution)
+		{
+			if (this->solution_file_path_.empty()) {
+				return;
+			}
+			const auto _name = this->solution_file_path_.substr(this->solution_file_path_.find_last_of("/\\") + 1);
+			__solution.write(__buffer[6], _name + "_" + std::to_string(this->trial()));
 		}
 
 		/*!
 		 * @brief			ログをファイルに書き込む
-		 * @detail			ログをファイルに書き込む
+		 * @detail			ログを文字列にしてから書き込みスレッドに渡す
 		 */
 		inline virtual void writeLog()
 		{
-			this->writeHistory();
+			output_buffer_type _buffer;
+			this->writeLog(_buffer);
+			this->writeOutput(_buffer);
+		}
+
+		/*!
+		 * @brief			ログを出力バッファに書き込む
+		 * @param[out]		__buffer 出力バッファ
+		 * @detail			ログをファイルではなく出力バッファに書き込む
+		 *					writeOutput() でファイルに書き込む
+		 */
+		inline void writeLog(output_buffer_type& __buffer)
+		{
+			this->writeLog(__buffer[1], __buffer[2], __buffer[3], __buffer[4]);
+			if (this->trace_chunk_size() != 0) {
+				this->trace_.endTrial();
+				__buffer[5] << this->trace_.take();
+			}
+#ifdef OKL_PROFILE
+			this->profile_.write(__buffer[7], this->trial());
+#endif
+		}
+
+		/*!
+		 * @brief			ログを出力ストリームに書き込む
+		 * @param[out]		__history_out 履歴出力ストリーム
+		 * @param[out]		__count_data_out カウントデータ出力ストリーム
+		 * @param[out]		__mode_count_out モード選択回数出力ストリーム
+		 * @param[out]		__mode_cost_avg_out モード平均コスト出力ストリーム
+		 * @detail			ログを指定の出力ストリームに書き込む
+		 */
+		inline virtual void writeLog(std::ostream& __history_out, std::ostream& __count_data_out, std::ostream& __mode_count_out, std::ostream& __mode_cost_avg_out)
+		{
+			if (this->trace_chunk_size() == 0) {
+				this->writeHistory(__history_out);
+			}
 
 			for (std::size_t _index = 0; _index < this->counts_.size(); ++_index) {
 				if (this->key_data(static_cast<key_type>(_index)) != 0) {
-					this->count_data_out_ << _index << "," << this->key_data(static_cast<key_type>(_index)) << std::endl;
+					__count_data_out << _index << "," << this->key_data(static_cast<key_type>(_index)) << std::endl;
 				}
 			}
 
@@ -554,8 +972,8 @@ namespace okl {
 				for (std::uint_least8_t _mode = 0; _mode < std::numeric_limits<mode_type>::max(); ++_mode) {
 					const auto _value = static_cast<double>(this->mode_count(_mode)) / _sum;
 					if (_value != 0) {
-						this->mode_count_out_ << static_cast<std::uint16_t>(_mode) << "," << std::fixed << std::setprecision(16) << _value << std::endl;
-						this->mode_count_out_ << std::defaultfloat;
+						__mode_count_out << static_cast<std::uint16_t>(_mode) << "," << std::fixed << std::setprecision(16) << _value << std::endl;
+						__mode_count_out << std::defaultfloat;
 					}
 				}
 
@@ -563,13 +981,105 @@ namespace okl {
 				for (std::uint_least8_t _mode = 0; _mode < std::numeric_limits<mode_type>::max(); ++_mode) {
 					const auto _value = static_cast<double>(this->mode_cost_avg(_mode)) / _sum;
 					if (_value != 0) {
-						this->mode_cost_avg_out_ << static_cast<std::uint16_t>(_mode) << "," << std::fixed << std::setprecision(16) << _value << std::endl;
-						this->mode_cost_avg_out_ << std::defaultfloat;
+						__mode_cost_avg_out << static_cast<std::uint16_t>(_mode) << "," << std::fixed << std::setprecision(16) << _value << std::endl;
+						__mode_cost_avg_out << std::defaultfloat;
 					}
 				}
 			}
 		}
 
+		/*!
+		 * @brief			出力バッファをファイルに書き込む
+		 * @param[in]		__buffer 出力バッファ
+		 * @detail			writeResult() writeLog() で出力バッファに書き込んだ内容をファイルに書き込む
+		 *					並列試行の結果を試行順に書き込むために用いる
+		 *					書き込みは書き込みスレッドで行い，書き込みの完了は待たない
+		 */
+		inline void writeOutput(const output_buffer_type& __buffer)
+		{
+			//解は試行ごとに別のファイルに書き込む
+			if (!this->solution_file_path_.empty() && !__buffer[6].str().empty()) {
+				this->writer_.open(6, this->solution_file_path_ + "_" + std::to_string(this->trial()) + ".tour");
+			}
+			//性能カウンタ値は最初に書き込むときに結果の隣に開く
+			if (!this->is_perf_output_opened_ && !__buffer[8].str().empty()) {
+				this->is_perf_output_opened_ = true;
+				if (this->openOutput(8, this->result_file_path_ + "_perf_.csv") == 0) {
+					this->writer_.write(8, "trial,scope,cycles,instructions,llc_misses,branch_misses,ipc\n");
+				}
+			}
+			for (std::size_t _index = 0; _index < __buffer.size(); ++_index) {
+				this->writer_.write(_index, __buffer[_index].str());
+			}
+		}
+
+		/*!
+		 * @brief			パラメーターを複製する
+		 * @param[in]		__other 複製元
+		 * @detail			clear関数では初期化されないパラメーターを複製する
+		 *					結果とログの出力先は複製しない　解の出力先は出力バッファへの書き込みに用いるため複製する
+		 */
+		inline void copyParameters(const SearchInfo& __other)
+		{
+			this->repeat_times_ = __other.repeat_times();
+			this->best_known_cost_ = __other.best_known_cost();
+			this->run_time_ = __other.run_time();
+			this->pop_size_ = __other.pop_size();
+			this->progress_name_ = __other.progress_name_;
+			this->timer_.setCheckInterval(__other.time_check_interval());
+			this->setTraceChunkSize(__other.trace_chunk_size());
+			this->solution_file_path_ = __other.solution_file_path_;
+			this->initial_solution_path_ = __other.initial_solution_path_;
+			this->trial_ = __other.trial_;
+			this->improvement_subscriber_ = __other.improvement_subscriber_;
+			this->is_perf_counter_enabled_ = __other.is_perf_counter_enabled_;
+		}
+
+		/*!
+		 * @brief			計測開始時刻を合わせる
+		 * @param[in]		__other 基準の探索情報クラス
+		 * @detail			内部のタイマーの実時間を基準の探索情報クラスのタイマーと同じ開始時刻にし，CPU時間は呼び出したスレッドで計測を開始する
+		 *					並列探索で各スレッドの探索情報クラスの時間を揃えるために用いる
+		 *					各スレッドの探索開始時に，そのスレッドから呼び出す
+		 */
+		inline void syncTime(const SearchInfo& __other)
+		{
+			this->timer_.syncStart(__other.timer_);
+		}
+
+		/*!
+		 * @brief			探索情報を統合する
+		 * @param[in]		__other 統合元
+		 * @detail			カウント，モードごとの集計，履歴を加算し，最良の結果を更新する
+		 *					並列探索で各スレッドの探索情報を集約するために用いる
+		 */
+		inline virtual void merge(const SearchInfo& __other)
+		{
+			if (this->best_result_ < __other.best_result_) {
+				this->best_result_ = __other.best_result_;
+			}
+			for (std::size_t _index = 0; _index < std::min(this->counts_.size(), __other.counts_.size()); ++_index) {
+				this->counts_[_index] += __other.counts_[_index];
+			}
+			for (std::size_t _index = 0; _index < std::min(this->modes_count_.size(), __other.modes_count_.size()); ++_index) {
+				this->modes_cost_sum_[_index] += __other.modes_cost_sum_[_index];
+				this->modes_count_[_index] += __other.modes_count_[_index];
+				this->modes_above_avg_count_[_index] += __other.modes_above_avg_count_[_index];
+			}
+			this->all_count_ += __other.all_count_;
+			this->all_cost_sum_ += __other.all_cost_sum_;
+			this->profile_.merge(__other.profile_);
+			for (std::size_t _phase = 0; _phase < Profile::phase_num; ++_phase) {
+				PerfCounter::add(this->perf_phases_[_phase], __other.perf_phases_[_phase]);
+				this->perf_phase_calls_[_phase] += __other.perf_phase_calls_[_phase];
+			}
+			this->history_.insert(this->history_.end(), __other.history_.begin(), __other.history_.end());
+			if (this->trace_chunk_size() != 0) {
+				this->trace_.append(__other.trace_);
+				this->writeTrace();
+			}
+		}
+
 		/*!
 		* @brief			代入処理を行う
 		* @param[in]		__other 代入元対象
@@ -587,6 +1097,7 @@ namespace okl {
 			this->best_known_cost_ = __other.best_known_cost();
 			std::copy(__other.history_.begin(), __other.history_.end(), this->history_.begin());
 			this->pop_size_ = __other.pop_size_;
+			this->progress_name_ = __other.progress_name_;
 			this->run_time_ = __other.run_time_;
 			this->mode_ = __other.mode_;
 			std::copy(__other.modes_cost_sum_.begin(), __other.modes_cost_sum_.end(), this->modes_cost_sum_.begin());
@@ -599,6 +1110,19 @@ namespace okl {
 			return (*this);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	カウンター，履歴，書き込みバッファが確保しているヒープ領域[byte]を返す
+		 * @detail			ログの量は試行ごとに増えるため，呼び出した時点の値を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->counts_) + okl::memorySize(this->history_)
+				+ okl::memorySize(this->modes_cost_sum_) + okl::memorySize(this->modes_count_) + okl::memorySize(this->modes_above_avg_count_)
+				+ okl::memorySize(this->result_file_path_) + okl::memorySize(this->log_file_path_) + okl::memorySize(this->solution_file_path_) + okl::memorySize(this->initial_solution_path_)
+				+ okl::memorySize(this->resume_output_sizes_) + okl::memorySize(this->writer_) + okl::memorySize(this->trace_) + okl::memorySize(this->progress_name_);
+		}
+
 	//protected:
 		//!カウンター用　コンテナ
 		std::vector<size_type> counts_;
@@ -628,6 +1152,9 @@ namespace okl {
 		//!母集団サイズ clear関数では初期化されない
 		size_type pop_size_;
 
+		//!進捗表示名 clear関数では初期化されない
+		std::string progress_name_;
+
 		//!実行時間 clear関数では初期化されない
 		double run_time_;
 
@@ -652,38 +1179,153 @@ namespace okl {
 		//!結果出力パス clear関数では初期化されない
 		std::string result_file_path_;
 
-		//!結果ファイル出力ストリーム clear関数では初期化されない
-		std::ofstream result_out_;
-
 		//!ログ出力パス clear関数では初期化されない
 		std::string log_file_path_;
 
-		//!履歴ファイル出力ストリーム clear関数では初期化されない
-		std::ofstream history_out_;
+		//!解出力パス 空文字列なら書き込まない clear関数では初期化されない
+		std::string solution_file_path_;
+
+		//!初期解ファイルパス clear関数では初期化されない
+		std::string initial_solution_path_;
+
+		//!試行番号 clear関数では初期化されない
+		size_type trial_;
+
+		//!改善イベントの購読者 clear関数では初期化されない
+		std::shared_ptr<improvement_subscriber_type> improvement_subscriber_;
+
+		//!再開時の出力ファイルサイズ 使用済みはstd::uint64_tの最大値 clear関数では初期化されない
+		std::vector<std::uint64_t> resume_output_sizes_;
+
+		//!結果とログの非同期書き込み 出力バッファと同じ番号のチャンネルに書き込む clear関数では初期化されない
+		AsyncWriter writer_;
+
+		//!バイナリ履歴 チャンクの行数が0ならテキスト形式の履歴を用いる
+		trace_type trace_;
+
+		//!バイナリ履歴をファイルに書き込むか clear関数では初期化されない
+		bool is_trace_output_;
+
+		//!段階ごとの計測値
+		Profile profile_;
+
+		//!性能カウンタによる計測を行うか clear関数では初期化されない
+		bool is_perf_counter_enabled_;
+
+		//!性能カウンタ値の出力ファイルを開いたか clear関数では初期化されない
+		bool is_perf_output_opened_;
 
-		//!カウントデータ出力ストリーム clear関数では初期化されない
-		std::ofstream count_data_out_;
+		//!呼び出したスレッドの性能カウンタ clear関数では初期化されない
+		PerfCounter perf_counter_;
 
-		//!モード選択回数出力ストリーム clear関数では初期化されない
-		std::ofstream mode_count_out_;
+		//!試行開始時の性能カウンタ値
+		PerfCounter::values_type perf_trial_begin_;
 
-		//!モード平均コスト出力ストリーム clear関数では初期化されない
-		std::ofstream mode_cost_avg_out_;
+		//!試行の性能カウンタ値
+		PerfCounter::values_type perf_trial_;
+
+		//!段階ごとの性能カウンタ値
+		std::array<PerfCounter::values_type, Profile::phase_num> perf_phases_;
+
+		//!段階ごとの性能カウンタ計測回数
+		std::array<size_type, Profile::phase_num> perf_phase_calls_;
+
+		/*!
+		 * @brief			性能カウンタ値を出力ストリームに書き込む
+		 * @param[out]		__out 出力ストリーム
+		 * @param[in]		__scope 計測範囲名
+		 * @param[in]		__values 計測値
+		 * @detail			計測できなかった値は空欄とする
+		 */
+		inline void writePerfCounter(std::ostream& __out, const std::string& __scope, const PerfCounter::values_type& __values) const
+		{
+			__out << this->trial() << "," << __scope;
+			for (const auto _value : __values) {
+				__out << ",";
+				if (_value != PerfCounter::unavailable) {
+					__out << _value;
+				}
+			}
+			__out << ",";
+			if (__values[0] != PerfCounter::unavailable && __values[1] != PerfCounter::unavailable && __values[0] != 0) {
+				__out << static_cast<double>(__values[1]) / static_cast<double>(__values[0]);
+			}
+			__out << "\n";
+		}
+
+		/*!
+		 * @brief			ログファイルを開く
+		 * @detail			バイナリ履歴を用いるなら履歴は_log_.binに書き込む
+		 */
+		inline void openLogFiles()
+		{
+			this->is_trace_output_ = this->trace_chunk_size() != 0;
+			if (this->is_trace_output_) {
+				if (this->openOutput(5, this->log_file_path_ + "_log_.bin", std::ios_base::out | std::ios_base::binary) == 0) {
+					this->writer_.write(5, trace_type::header());
+				}
+			}
+			else {
+				this->openOutput(1, this->log_file_path_ + "_log_.csv");
+			}
+			this->openOutput(2, this->log_file_path_ + "_count_.csv");
+			this->openOutput(3, this->log_file_path_ + "_mode_count_.csv");
+			this->openOutput(4, this->log_file_path_ + "_mode_cost_avg_.csv");
+#ifdef OKL_PROFILE
+			if (this->openOutput(7, this->log_file_path_ + "_profile_.csv") == 0) {
+				this->writer_.write(7, Profile::header());
+			}
+#endif
+		}
+
+		/*!
+		 * @brief			出力ファイルを開く
+		 * @param[in]		__channel 出力バッファと同じ番号のチャンネル
+		 * @param[in]		__path ファイルパス
+		 * @param[in]		__mode 開くモード
+		 * @return			std::uint64_t	再開時は追記を始めるファイルサイズ，それ以外は0を返す
+		 * @detail			resumeOutput関数で再開時のサイズが設定されていれば，そのサイズに切り詰めて追記する
+		 *					再開時のサイズは一度だけ用いる
+		 */
+		inline std::uint64_t openOutput(const std::size_t __channel, const std::string& __path, const std::ios_base::openmode __mode = std::ios_base::out)
+		{
+			if (__channel < this->resume_output_sizes_.size() && this->resume_output_sizes_[__channel] != std::numeric_limits<std::uint64_t>::max()) {
+				const auto _size = this->resume_output_sizes_[__channel];
+				this->resume_output_sizes_[__channel] = std::numeric_limits<std::uint64_t>::max();
+				this->writer_.resume(__channel, __path, _size);
+				return _size;
+			}
+			this->writer_.open(__channel, __path, __mode);
+			return 0;
+		}
+
+		/*!
+		 * @brief			変換済みのバイナリ履歴をファイルに書き込む
+		 * @detail			チャンクが埋まるごとに書き込みスレッドに渡し，試行中に履歴を溜め込まない
+		 *					ファイルに書き込まない探索情報クラスでは試行終了まで保持する
+		 */
+		inline void writeTrace()
+		{
+			if (this->is_trace_output_ && this->trace_.data_size() != 0) {
+				this->writer_.write(5, this->trace_.take());
+			}
+		}
 
 		/*!
-		 * @brief			履歴をファイルに書き込む
-		 * @detail			履歴をファイルに書き込む
+		 * @brief			履歴を出力ストリームに書き込む
+		 * @param[out]		__history_out 履歴出力ストリーム
+		 * @detail			履歴を出力ストリームに書き込む
 		 */
 		template<std::size_t _N = 0>
-		inline void writeHistory()
+		inline void writeHistory(std::ostream& __history_out)
 		{
 			if constexpr (_N < std::tuple_size<__Info>::value) {
 				for (const auto& _tuple : this->history()) {
-					this->history_out_ << std::get<_N>(_tuple) << ",";
+					__history_out << std::get<_N>(_tuple) << ",";
 				}
-				this->history_out_ << std::endl;
+				__history_out << std::endl;
 
-				this->writeHistory<_N + 1>();
+				this->writeHistory<_N + 1>(__history_out);
 			}
 		}
 	};
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "../HashSet/module.hpp"
+#include "../ConcatContainer/module.hpp"
 
 namespace okl {
 	/*!
@@ -6,13 +6,24 @@
 #include <iomanip>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <ctime>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 
 namespace okl {
 	/*!
 	 *  @brief		タイマークラス
 	 *  @details    タイマークラス
 	 *				計測のための汎用的な計測クラス
+	 *				isOver関数はconstでも判定回数と判定結果を書き換えるため，1つのタイマーを複数のスレッドから同時に呼び出さないこと
+	 *				並列探索ではスレッドごとにsyncStart関数で開始したタイマーを使い，共有するタイマーは排他制御の下でのみ判定する
 	 */
 	class Timer
 	{
@@ -20,14 +31,14 @@ namespace okl {
 		/*!
 		 * @brief				コンストラクタ
 		 */
-		Timer() : start_time_(clock::time_point::min()) {}
+		Timer() : start_time_(clock::time_point::min()), start_cpu_time_(0.0), check_interval_(1), check_count_(0), is_over_(false) {}
 
 		/*!
 		 * @brief				デストラクタ
 		 */
 		virtual ~Timer() = default;
 
-		using clock = std::chrono::high_resolution_clock;
+		using clock = std::chrono::steady_clock;
 		using nanoseconds = std::chrono::duration<double, std::nano>;
 		using microseconds = std::chrono::duration<double, std::micro>;
 		using milliseconds = std::chrono::duration<double, std::milli>;
@@ -42,6 +53,8 @@ namespace okl {
 		void clear()
 		{
 			this->start_time_ = clock::time_point::min();
+			this->check_count_ = 0;
+			this->is_over_ = false;
 		}
 
 		/*!
@@ -61,7 +74,25 @@ namespace okl {
 		inline void start()
 		{
 			this->start_time_ = clock::now();
-			this->start_clock_ = std::clock();
+			this->start_cpu_time_ = Timer::threadCpuTime();
+			this->thread_id_ = std::this_thread::get_id();
+			this->check_count_ = 0;
+			this->is_over_ = false;
+		}
+
+		/*!
+		 * @brief			基準のタイマーと開始時刻を揃えて計測開始
+		 * @param[in]		__other 基準のタイマー 開始済みであること
+		 * @detail			実時間の開始時刻のみ基準のタイマーと共有し，CPU時間は呼び出したスレッドで計測を開始する
+		 *					並列探索で各スレッドが同じ制限時間で終了するように，各スレッドの開始時に呼び出す
+		 */
+		inline void syncStart(const Timer& __other)
+		{
+			this->start_time_ = __other.start_time_;
+			this->start_cpu_time_ = Timer::threadCpuTime();
+			this->thread_id_ = std::this_thread::get_id();
+			this->check_count_ = 0;
+			this->is_over_ = false;
 		}
 
 		/*!
@@ -84,14 +115,15 @@ namespace okl {
 		/*!
 		 * @brief			開始してからのCPU時間を返す
 		 * @return			double　開始してからのdouble型CPU時間を返す
-		 * @detail			開始してからのdouble型CPU時間を返す
+		 * @detail			開始してからの計測開始したスレッドのdouble型CPU時間を返す
+		 *					計測開始したスレッドから呼び出す
 		 *					テンプレート__Timeにはクラス内で定義している時間型を定義として渡す
 		 */
 		template<class __Time>
-		constexpr double cpu_time() const
+		inline double cpu_time() const
 		{
 			if (this->isStarted()) {
-				seconds sec(static_cast<double>(std::clock() - this->start_clock_) / static_cast<double>(CLOCKS_PER_SEC));
+				seconds sec(Timer::threadCpuTime() - this->start_cpu_time_);
 				return std::chrono::duration_cast <__Time> (sec).count();
 			}
 			else {
@@ -99,11 +131,96 @@ namespace okl {
 			}
 		}
 
+		/*!
+		 * @brief			計測開始したスレッドから呼び出したか判定
+		 * @return			bool　計測開始したスレッドならTrue
+		 * @detail			cpu_time関数の値は計測開始したスレッドから呼び出した場合のみ意味を持つ
+		 */
+		inline bool isStartedThread() const
+		{
+			return this->thread_id_ == std::this_thread::get_id();
+		}
+
+		/*!
+		 * @brief			制限時間の判定間隔を設定
+		 * @param[in]		__check_interval 判定間隔 isOver関数の呼び出し何回ごとに時計を読むか
+		 * @detail			制限時間の判定間隔を設定する
+		 */
+		inline void setCheckInterval(const std::size_t __check_interval)
+		{
+			this->check_interval_ = __check_interval == 0 ? 1 : __check_interval;
+		}
+
+		/*!
+		 * @brief			制限時間の判定間隔を返す
+		 * @return			std::size_t　判定間隔を返す
+		 */
+		constexpr std::size_t check_interval() const
+		{
+			return this->check_interval_;
+		}
+
+		/*!
+		 * @brief			開始してからの実時間が制限時間以上か判定
+		 * @param[in]		__limit 制限時間[秒]
+		 * @return			bool　制限時間以上ならTrue
+		 * @detail			時計は判定間隔の呼び出しごとにのみ読み，それ以外は前回の判定を返す
+		 *					一度制限時間以上と判定したら以降は時計を読まずにTrueを返す
+		 *					判定回数と判定結果を書き換えるため，スレッドセーフではない
+		 */
+		inline bool isOver(const double __limit) const
+		{
+			if (!this->is_over_ && this->check_count_++ % this->check_interval_ == 0) {
+				this->is_over_ = __limit <= this->time<seconds>();
+			}
+			return this->is_over_;
+		}
+
+		/*!
+		 * @brief			現在のスレッドのCPU時間を返す
+		 * @return			double　スレッドのdouble型CPU時間[秒]を返す
+		 * @detail			POSIXではCLOCK_THREAD_CPUTIME_ID，WindowsではGetThreadTimesを用いる
+		 *					どちらも使えない環境ではプロセスのCPU時間を返す
+		 */
+		static double threadCpuTime()
+		{
+#if defined(_WIN32)
+			FILETIME _creation_time, _exit_time, _kernel_time, _user_time;
+			if (GetThreadTimes(GetCurrentThread(), &_creation_time, &_exit_time, &_kernel_time, &_user_time)) {
+				ULARGE_INTEGER _kernel, _user;
+				_kernel.LowPart = _kernel_time.dwLowDateTime;
+				_kernel.HighPart = _kernel_time.dwHighDateTime;
+				_user.LowPart = _user_time.dwLowDateTime;
+				_user.HighPart = _user_time.dwHighDateTime;
+				//100ナノ秒単位
+				return static_cast<double>(_kernel.QuadPart + _user.QuadPart) * 1e-7;
+			}
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+			timespec _time;
+			if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &_time) == 0) {
+				return static_cast<double>(_time.tv_sec) + static_cast<double>(_time.tv_nsec) * 1e-9;
+			}
+#endif
+			return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+		}
+
 	private:
 		//!開始時間
 		clock::time_point start_time_;
 
-		//!開始クロック
-		clock_t start_clock_;
+		//!開始時のスレッドのCPU時間[秒]
+		double start_cpu_time_;
+
+		//!計測開始したスレッド
+		std::thread::id thread_id_;
+
+		//!制限時間の判定間隔
+		std::size_t check_interval_;
+
+		//!制限時間の判定呼び出し回数
+		mutable std::size_t check_count_;
+
+		//!制限時間以上と判定済みか
+		mutable bool is_over_;
 	};
 } /* namespace okl */
\ No newline at end of file
@@ -0,0 +1,39 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      完全結合型移住トポロジークラス
+	 *  @details    各島から他の全ての島へ移住するトポロジー
+	 */
+	class FullyConnectedTopology
+	{
+	public:
+		using size_type = std::size_t;
+
+		/*!
+		 * @brief				トポロジー名
+		 * @return				std::string	このトポロジーの名前を返す
+		 */
+		static const std::string info() { return "完全結合"; }
+
+		/*!
+		 * @brief			移住先の島を返す
+		 * @param[in]		__island 移住元の島番号
+		 * @param[in]		__island_num 島数
+		 * @return			std::vector<size_type>	移住先の島番号を返す
+		 */
+		static std::vector<size_type> destinations(const size_type __island, const size_type __island_num)
+		{
+			std::vector<size_type> _destinations;
+			for (size_type _island = 0; _island < __island_num; ++_island) {
+				if (_island != __island) {
+					_destinations.push_back(_island);
+				}
+			}
+			return _destinations;
+		}
+	};
+} /* namespace okl */
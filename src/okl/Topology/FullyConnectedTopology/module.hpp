@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "FullyConnectedTopology.hpp"
\ No newline at end of file
@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+
+namespace okl {
+	/*!
+	 *  @brief      リング型移住トポロジークラス
+	 *  @details    島iから島(i+1)へ一方向に移住するトポロジー
+	 */
+	class RingTopology
+	{
+	public:
+		using size_type = std::size_t;
+
+		/*!
+		 * @brief				トポロジー名
+		 * @return				std::string	このトポロジーの名前を返す
+		 */
+		static const std::string info() { return "リング"; }
+
+		/*!
+		 * @brief			移住先の島を返す
+		 * @param[in]		__island 移住元の島番号
+		 * @param[in]		__island_num 島数
+		 * @return			std::vector<size_type>	移住先の島番号を返す
+		 */
+		static std::vector<size_type> destinations(const size_type __island, const size_type __island_num)
+		{
+			if (__island_num <= 1) {
+				return {};
+			}
+			return { (__island + 1) % __island_num };
+		}
+	};
+} /* namespace okl */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "RingTopology.hpp"
\ No newline at end of file
@@ -0,0 +1,3 @@
+﻿#pragma once
+#include "RingTopology/module.hpp"
+#include "FullyConnectedTopology/module.hpp"
\ No newline at end of file
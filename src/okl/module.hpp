@@ -7,6 +7,7 @@
 #include "Span/module.hpp"
 #include "BitSet/module.hpp"
 #include "Stack/module.hpp"
+#include "HugePage/module.hpp"
 #include "Matrix/module.hpp"
 #include "Vertex/module.hpp"
 #include "Graph/module.hpp"
@@ -15,9 +16,22 @@
 #include "Instance/module.hpp"
 #include "Condition/module.hpp"
 #include "Run/module.hpp"
+#include "Parallel/module.hpp"
+#include "Scheduler/module.hpp"
+#include "LockFreeQueue/module.hpp"
+#include "Topology/module.hpp"
+#include "AsyncWriter/module.hpp"
+#include "BinaryTrace/module.hpp"
+#include "Checkpoint/module.hpp"
+#include "ImprovementStream/module.hpp"
+#include "Profile/module.hpp"
+#include "PerfCounter/module.hpp"
+#include "ChromeTrace/module.hpp"
 #include "Operator/module.hpp"
 #include "TypeSet/module.hpp"
 #include "SetWithInnerDegree/module.hpp"
 #include "ConcatContainer/module.hpp"
+#include "Arena/module.hpp"
 #include "Population/module.hpp"
+#include "MemorySize/module.hpp"
 #include "Utility/module.hpp"
\ No newline at end of file
@@ -0,0 +1,149 @@
+﻿#pragma once
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace okl::tsp {
+	/*!
+	* @brief			一様乱数配置の座標を生成する
+	* @param[in]		__size			頂点数
+	* @param[in]		__seed			シード
+	* @param[in]		__width			配置範囲の幅 座標は[0, __width)
+	* @param[in]		__is_real		trueなら実数座標 falseなら整数座標
+	* @return			std::vector		座標を返す
+	* @detail			同じ引数なら同じ座標を生成する
+	*/
+	inline std::vector<std::pair<double, double>> generateUniformPositions(const std::size_t __size, const std::seed_seq::result_type __seed, const std::size_t __width = 10000, const bool __is_real = false)
+	{
+		std::mt19937_64 _engine(__seed);
+		std::vector<std::pair<double, double>> _positions(__size);
+		if (__is_real) {
+			std::uniform_real_distribution<double> _distribution(0.0, static_cast<double>(__width));
+			for (auto& [_x, _y] : _positions) {
+				_x = _distribution(_engine);
+				_y = _distribution(_engine);
+			}
+			return _positions;
+		}
+		for (auto& [_x, _y] : _positions) {
+			_x = static_cast<double>(_engine() % __width);
+			_y = static_cast<double>(_engine() % __width);
+		}
+		return _positions;
+	}
+
+	/*!
+	* @brief			クラスタ配置の座標を生成する
+	* @param[in]		__size			頂点数
+	* @param[in]		__seed			シード
+	* @param[in]		__width			配置範囲の幅 座標は[0, __width)
+	* @param[in]		__is_real		trueなら実数座標 falseなら整数座標
+	* @param[in]		__cluster_num	クラスタ数 0なら頂点数/100(最低1)
+	* @return			std::vector		座標を返す
+	* @detail			DIMACS TSP Challengeのクラスタ問題例と同様に，一様乱数配置のクラスタ中心の周りに
+	*					標準偏差__width/sqrt(__size)の正規分布で頂点を配置する
+	*					範囲外の座標は範囲内に丸める
+	*/
+	inline std::vector<std::pair<double, double>> generateClusteredPositions(const std::size_t __size, const std::seed_seq::result_type __seed, const std::size_t __width = 10000, const bool __is_real = false, const std::size_t __cluster_num = 0)
+	{
+		const auto _cluster_num = __cluster_num != 0 ? __cluster_num : std::max<std::size_t>(__size / 100, 1);
+		std::mt19937_64 _engine(__seed);
+		std::uniform_real_distribution<double> _center_distribution(0.0, static_cast<double>(__width));
+		std::vector<std::pair<double, double>> _centers(_cluster_num);
+		for (auto& [_x, _y] : _centers) {
+			_x = _center_distribution(_engine);
+			_y = _center_distribution(_engine);
+		}
+
+		std::normal_distribution<double> _distribution(0.0, static_cast<double>(__width) / std::sqrt(static_cast<double>(std::max<std::size_t>(__size, 1))));
+		const auto _max = std::nextafter(static_cast<double>(__width), 0.0);
+		std::vector<std::pair<double, double>> _positions(__size);
+		for (auto& [_x, _y] : _positions) {
+			const auto& [_center_x, _center_y] = _centers[_engine() % _cluster_num];
+			_x = std::clamp(_center_x + _distribution(_engine), 0.0, _max);
+			_y = std::clamp(_center_y + _distribution(_engine), 0.0, _max);
+			if (!__is_real) {
+				_x = std::floor(_x);
+				_y = std::floor(_y);
+			}
+		}
+		return _positions;
+	}
+
+	/*!
+	* @brief			格子配置の座標を生成する
+	* @param[in]		__size			頂点数
+	* @param[in]		__width			配置範囲の幅 座標は[0, __width)
+	* @param[in]		__is_real		trueなら実数座標 falseなら整数座標
+	* @return			std::vector		座標を返す
+	* @detail			一辺ceil(sqrt(__size))点の正方格子に行優先で__size点を配置する
+	*					最適巡回路長が既知になりやすく，同じ長さの辺が多い
+	*/
+	inline std::vector<std::pair<double, double>> generateGridPositions(const std::size_t __size, const std::size_t __width = 10000, const bool __is_real = false)
+	{
+		const auto _side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(__size))));
+		const auto _spacing = _side != 0 ? static_cast<double>(__width) / static_cast<double>(_side) : 0.0;
+		std::vector<std::pair<double, double>> _positions(__size);
+		for (std::size_t _id = 0; _id < __size; ++_id) {
+			auto& [_x, _y] = _positions[_id];
+			_x = static_cast<double>(_id % _side) * _spacing;
+			_y = static_cast<double>(_id / _side) * _spacing;
+			if (!__is_real) {
+				_x = std::floor(_x);
+				_y = std::floor(_y);
+			}
+		}
+		return _positions;
+	}
+
+	/*!
+	* @brief			指定した配置の座標を生成する
+	* @param[in]		__distribution	配置 uniform, clustered, grid
+	* @param[in]		__size			頂点数
+	* @param[in]		__seed			シード gridでは使わない
+	* @param[in]		__width			配置範囲の幅 座標は[0, __width)
+	* @param[in]		__is_real		trueなら実数座標 falseなら整数座標
+	* @return			std::vector		座標を返す 配置名が不正なら空を返す
+	*/
+	inline std::vector<std::pair<double, double>> generatePositions(const std::string& __distribution, const std::size_t __size, const std::seed_seq::result_type __seed, const std::size_t __width = 10000, const bool __is_real = false)
+	{
+		if (__distribution == "uniform") {
+			return generateUniformPositions(__size, __seed, __width, __is_real);
+		}
+		else if (__distribution == "clustered") {
+			return generateClusteredPositions(__size, __seed, __width, __is_real);
+		}
+		else if (__distribution == "grid") {
+			return generateGridPositions(__size, __width, __is_real);
+		}
+		return {};
+	}
+
+	/*!
+	* @brief			巡回セールスマン問題をTSPLIBのアスキー形式で書き込む
+	* @param[out]		__out			出力ストリーム
+	* @param[in]		__name			問題例名
+	* @param[in]		__positions		座標
+	* @param[in]		__type			距離の種類 EUC_2D, EUC_2D_REAL
+	* @detail			loadで読み込める形式で書き込む
+	*/
+	inline void writeInstance(std::ostream& __out, const std::string& __name, const std::vector<std::pair<double, double>>& __positions, const std::string& __type = "EUC_2D")
+	{
+		__out << "NAME : " << __name << "\n";
+		__out << "COMMENT : generated " << __positions.size() << " cities\n";
+		__out << "TYPE : TSP\n";
+		__out << "DIMENSION : " << __positions.size() << "\n";
+		__out << "EDGE_WEIGHT_TYPE : " << __type << "\n";
+		__out << "NODE_COORD_SECTION\n";
+		const auto _precision = __out.precision(10);
+		for (std::size_t _id = 0; _id < __positions.size(); ++_id) {
+			__out << _id + 1 << " " << __positions[_id].first << " " << __positions[_id].second << "\n";
+		}
+		__out.precision(_precision);
+		__out << "EOF\n";
+	}
+} /* namespace okl::tsp */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Generate.hpp"
\ No newline at end of file
@@ -1,7 +1,56 @@
 ﻿#pragma once
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
 #include <string>
 
 namespace okl::tsp {
+	/*!
+	* @brief			巡回セールスマン問題のアスキー形式の問題の頂点数を読み込む
+	* @param[in]		__path			問題ファイルパス
+	* @return			std::size_t		頂点数を返す 読み込めなければ0を返す
+	* @detail			ヘッダー部のDIMENSIONのみを読み込む
+	*/
+	inline std::size_t loadDimension(const std::string& __path)
+	{
+		std::ifstream _fin(__path);
+
+		std::string _baffer = "";
+		while (std::getline(_fin, _baffer) && _baffer.find("NODE_COORD_SECTION") == std::string::npos)
+		{
+			_baffer.erase(remove(_baffer.begin(), _baffer.end(), ' '), _baffer.end());
+			const std::string _dimension_str = "DIMENSION:";
+			const auto _pos = _baffer.find(_dimension_str);
+			if (_pos != std::string::npos) {
+				std::istringstream _stream(_baffer.substr(_dimension_str.size(), _baffer.size() - _dimension_str.size()));
+
+				//ノード数N
+				std::size_t _load_size = 0;
+
+				_stream >> _load_size;
+
+				return _load_size;
+			}
+		}
+		return 0;
+	}
+
+	/*!
+	* @brief			問題を読み込んだグラフの推定メモリ使用量を返す
+	* @param[in]		__size			頂点数
+	* @return			std::size_t		推定メモリ使用量[byte]を返す
+	* @detail			隣接行列と頂点配列の要素分のメモリ使用量を返す
+	*/
+	template<class __Graph>
+	constexpr std::size_t estimateMemorySize(const std::size_t __size)
+	{
+		using matrix_type = typename __Graph::adjacent_matrix_type;
+
+		const std::size_t _matrix_size = matrix_type::symmetric::value ? __size * (__size + 1) / 2 : __size * __size;
+		return _matrix_size * sizeof(typename matrix_type::value_type) + __size * sizeof(typename __Graph::vertex_type);
+	}
+
 	/*!
 	* @brief			巡回セールスマン問題のアスキー形式の問題を読み込む
 	* @param[in]		__path			問題ファイルパス
@@ -0,0 +1,81 @@
+﻿#pragma once
+
+#include "../PerturbationOperator.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace okl::tsp {
+	/*!
+	 *  @brief      二重橋摂動関数クラス
+	 *  @details    二重橋摂動関数クラス
+	 *				巡回路の連続する3区間X Y Zの並びをZ Y Xにし，4本の辺を繋ぎ変える
+	 *				繋ぎ変えで端点が変わる頂点は8つのみなので，局所探索は端点の周りのみをやり直せばよい
+	 *				8つの端点は解クラスに前後の頂点が変わった頂点として記録され，近傍リストルートスワップの調べ始める頂点になる
+	 *				区間長を上限で抑えると摂動が巡回路の一部に留まり，書き換えも区間内のみになる
+	 *				- __MaxSegmentLength	区間長の上限 0なら上限なしで巡回路全体から切る辺を選ぶ
+	 */
+	template<std::size_t __MaxSegmentLength = 50>
+	class DoubleBridgePerturbationOperator : public PerturbationOperator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		DoubleBridgePerturbationOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~DoubleBridgePerturbationOperator() = default;
+
+		using random_device_type = typename PerturbationOperator::random_device_type;
+		using seed_type = typename PerturbationOperator::seed_type;
+		using size_type = typename PerturbationOperator::size_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return  "二重橋" + PerturbationOperator::info() + (__MaxSegmentLength == 0 ? std::string() : "<区間長" + std::to_string(__MaxSegmentLength) + ">"); }
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 *					4区間に分けられない8頂点未満の巡回路は変更しない
+		 */
+		template<class __SearchInfo, class __Solution>
+		inline void operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) {
+			using index_type = typename __Solution::index_type;
+
+			const index_type _size = __solution.route().size();
+			if (_size < 8) {
+				return;
+			}
+
+			//切る辺は各区間の先頭の直前の辺 区間の外側には1頂点以上残す
+			std::array<index_type, 4> _indices;
+			if (__MaxSegmentLength == 0) {
+				do {
+					for (auto& _index : _indices) {
+						_index = this->random_device_.template uniform_int<index_type>(0, _size - 1);
+					}
+					std::sort(_indices.begin(), _indices.end());
+				} while (std::adjacent_find(_indices.begin(), _indices.end()) != _indices.end());
+			}
+			else {
+				const index_type _max_length = std::min<index_type>(__MaxSegmentLength, (_size - 1) / 3);
+				const auto _length_x = this->random_device_.template uniform_int<index_type>(1, _max_length);
+				const auto _length_y = this->random_device_.template uniform_int<index_type>(1, _max_length);
+				const auto _length_z = this->random_device_.template uniform_int<index_type>(1, _max_length);
+				_indices[0] = this->random_device_.template uniform_int<index_type>(0, _size - (_length_x + _length_y + _length_z));
+				_indices[1] = _indices[0] + _length_x;
+				_indices[2] = _indices[1] + _length_y;
+				_indices[3] = _indices[2] + _length_z;
+			}
+
+			__solution.routeDoubleBridge(__graph, _indices[0], _indices[1], _indices[2], _indices[3],
+				__solution.gaincostAfterRouteDoubleBridge(__graph, _indices[0], _indices[1], _indices[2], _indices[3]));
+		}
+	};
+} /* namespace okl::tsp */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "DoubleBridgePerturbationOperator.hpp"
\ No newline at end of file
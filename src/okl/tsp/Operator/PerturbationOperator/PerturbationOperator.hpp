@@ -0,0 +1,34 @@
+﻿#pragma once
+
+#include "../../../Operator/module.hpp"
+
+namespace okl::tsp {
+	/*!
+	 *  @brief      摂動関数基底クラス
+	 *  @details    摂動関数基底クラス
+	 */
+	class PerturbationOperator : public Operator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		PerturbationOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~PerturbationOperator() = default;
+
+		using random_device_type = typename Operator::random_device_type;
+		using seed_type = typename Operator::seed_type;
+		using size_type = typename Operator::size_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return  "摂動"; }
+
+	};
+} /* namespace okl::tsp */
@@ -0,0 +1,3 @@
+﻿#pragma once
+#include "PerturbationOperator.hpp"
+#include "DoubleBridgePerturbationOperator/module.hpp"
\ No newline at end of file
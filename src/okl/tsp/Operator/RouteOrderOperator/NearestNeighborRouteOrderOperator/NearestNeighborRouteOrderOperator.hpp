@@ -63,7 +63,7 @@ namespace okl::tsp {
 		 */
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) {
-			__solution = __initial_solution;
+			__solution.reset(__initial_solution);
 			this->nodes_ = __solution.nodes();
 
 			auto _select_node_id = this->random_device_.random_element(this->nodes_);
@@ -2,10 +2,15 @@
 
 #include "../../../Operator/module.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace okl::tsp {
 	/*!
 	 *  @brief      ランダムルート順序設定関数基底クラス
 	 *  @details    ランダムルート順序設定関数基底クラス
+	 *				解のノードID集合は共有されていて変更できないため，並び替え用の頂点ID配列を持つ
+	 *				頂点ID配列は呼び出しごとに前回の並びからシャッフルし，シードを設定したときにノードID集合の並びに戻す
 	 */
 	class RandomRouteOrderOperator : public RouteOrderOperator
 	{
@@ -30,18 +35,59 @@ namespace okl::tsp {
 		 */
 		static const std::string info() { return  "ランダム" + RouteOrderOperator::info(); }
 
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			頂点ID配列のメモリ確保を行う
+		 */
+		inline virtual void resize(const size_type __size) override
+		{
+			RouteOrderOperator::resize(__size);
+			this->nodes_.reserve(__size);
+		}
+
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定し，頂点ID配列を次の呼び出しでノードID集合の並びに戻す
+		 *					試行ごとに設定されるため，試行の結果はシードのみで決まる
+		 */
+		inline virtual void seed(const seed_type __seed) override
+		{
+			RouteOrderOperator::seed(__seed);
+			this->nodes_.clear();
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	頂点ID配列が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->nodes_);
+		}
+
 		/*!
 		 * @brief			クラスに関連付けられた演算を実行
 		 * @detail			クラスに関連付けられた演算を実行する
 		 */
 		template<class __SearchInfo, class __Solution>
 		inline void operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) {
-			__solution = __initial_solution;
-			__solution.shuffleNodes(this->random_device_.engin());
-			for (const auto _node_id : __solution.nodes()) {
-				__solution.setRouteOrder(__graph, _node_id);
+			using id_type = typename __Solution::id_type;
+
+			__solution.reset(__initial_solution);
+			if (this->nodes_.size() != __solution.nodes().size()) {
+				this->nodes_.assign(__solution.nodes().begin(), __solution.nodes().end());
+			}
+			std::shuffle(this->nodes_.begin(), this->nodes_.end(), this->random_device_.engin());
+			for (const auto _node_id : this->nodes_) {
+				__solution.setRouteOrder(__graph, static_cast<id_type>(_node_id));
 			}
 			__solution.calculateCost(__graph);
 		}
+
+	private:
+		//!並び替え用の頂点ID配列
+		std::vector<std::size_t> nodes_;
 	};
 } /* namespace okl::tsp */
\ No newline at end of file
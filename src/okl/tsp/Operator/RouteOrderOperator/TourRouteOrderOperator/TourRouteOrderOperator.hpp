@@ -0,0 +1,72 @@
+﻿#pragma once
+
+#include "../../../Operator/module.hpp"
+#include "../../../Tour/module.hpp"
+
+namespace okl::tsp {
+	/*!
+	 *  @brief      巡回路ファイルルート順序設定関数クラス
+	 *  @details    探索情報クラスの初期解ファイルパスからTSPLIBのTOUR形式の巡回路を読み込み，ルート順序とする
+	 *				前回の最良解から探索を再開するために用いる
+	 *				読み込んだ巡回路は保持し，ファイルパスが変わったときのみ読み込み直す
+	 *				ファイルパスの指定がない，または巡回路が頂点数と合わない場合はランダムなルート順序とする
+	 */
+	class TourRouteOrderOperator : public RandomRouteOrderOperator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		TourRouteOrderOperator() : is_loaded_(false) {}
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~TourRouteOrderOperator() = default;
+
+		using random_device_type = typename RandomRouteOrderOperator::random_device_type;
+		using seed_type = typename RandomRouteOrderOperator::seed_type;
+		using size_type = typename RandomRouteOrderOperator::size_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return  "巡回路ファイル" + RouteOrderOperator::info(); }
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __SearchInfo, class __Solution>
+		inline void operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) {
+			if (this->path_ != __search_info.initial_solution_path()) {
+				this->path_ = __search_info.initial_solution_path();
+				this->is_loaded_ = !this->path_.empty() && loadTour(this->path_, this->route_);
+				if (!this->path_.empty() && !this->is_loaded_) {
+					std::cout << this->path_ << " を読み込めないためランダムなルート順序を用います" << std::endl;
+				}
+			}
+			if (!this->is_loaded_ || this->route_.size() != __initial_solution.route().size()) {
+				RandomRouteOrderOperator::operator()(__graph, __search_info, __solution, __initial_solution, __best_solution);
+				return;
+			}
+
+			__solution.reset(__initial_solution);
+			for (const auto _node_id : this->route_) {
+				__solution.setRouteOrder(__graph, _node_id);
+			}
+			__solution.calculateCost(__graph);
+		}
+
+	private:
+		//!読み込んだ巡回路ファイルパス
+		std::string path_;
+
+		//!巡回路を読み込めたか
+		bool is_loaded_;
+
+		//!読み込んだ巡回路
+		std::vector<std::size_t> route_;
+	};
+} /* namespace okl::tsp */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "TourRouteOrderOperator.hpp"
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#pragma once
 #include "RouteOrderOperator.hpp"
 #include "RandomRouteOrderOperator/module.hpp"
-#include "NearestNeighborRouteOrderOperator/module.hpp"
\ No newline at end of file
+#include "NearestNeighborRouteOrderOperator/module.hpp"
+#include "TourRouteOrderOperator/module.hpp"
\ No newline at end of file
@@ -1,11 +1,18 @@
 ﻿#pragma once
 
 #include "../RouteSwapOperator.hpp"
+#include "../../../../Profile/module.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 namespace okl::tsp {
 	/*!
 	 *  @brief      最良移動戦略ルートスワップ関数クラス
 	 *  @details    最良移動戦略ルートスワップ関数クラス
+	 *				同じ改善量の移動のうちどれを選ぶかをランダムにするため，ルートインデックスの評価順をシャッフルする
+	 *				評価順の配列は呼び出しごとに前回の並びからシャッフルし，シードを設定したときに昇順に戻す
 	 */
 	class BestImprovementRouteSwapOperator : public RouteSwapOperator
 	{
@@ -30,6 +37,38 @@ namespace okl::tsp {
 		 */
 		static const std::string info() { return  "最良移動戦略" + RouteSwapOperator::info(); }
 
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			評価順の配列のメモリ確保を行う
+		 */
+		inline virtual void resize(const size_type __size) override
+		{
+			RouteSwapOperator::resize(__size);
+			this->indices_.reserve(__size);
+		}
+
+		/*!
+		 * @brief			シードを設定
+		 * @param[in]		__seed シード
+		 * @detail			メンバ変数のシードを設定し，評価順を次の呼び出しで昇順に戻す
+		 *					試行ごとに設定されるため，試行の結果はシードのみで決まる
+		 */
+		inline virtual void seed(const seed_type __seed) override
+		{
+			RouteSwapOperator::seed(__seed);
+			this->indices_.clear();
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	評価順の配列が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->indices_);
+		}
+
 		/*!
 		 * @brief			クラスに関連付けられた演算を実行
 		 * @detail			クラスに関連付けられた演算を実行する
@@ -39,17 +78,21 @@ namespace okl::tsp {
 			using size_type = typename __Solution::size_type;
 			using cost_type = typename __Solution::cost_type;
 
-			__solution.shuffleNodes(this->random_device_.engin());
+			if (this->indices_.size() != __solution.route().size()) {
+				this->indices_.resize(__solution.route().size());
+				std::iota(this->indices_.begin(), this->indices_.end(), 0);
+			}
+			std::shuffle(this->indices_.begin(), this->indices_.end(), this->random_device_.engin());
 
 			cost_type _best_gaincost = 0;
 			size_type _candidate_index_a = std::numeric_limits<size_type>::max();
 			size_type _candidate_index_b = std::numeric_limits<size_type>::max();
-			const size_type _last_index = static_cast<size_type>(__solution.nodes().size() - 1);
+			const size_type _last_index = static_cast<size_type>(this->indices_.size() - 1);
 
 			for (size_type _index_a = 0; _index_a < _last_index; ++_index_a) {
-				const auto _r_index_a = __solution.nodes()[_index_a];				
-				for (size_type _index_b = static_cast<size_type>(_index_a + 1); _index_b < __solution.nodes().size(); ++_index_b) {
-					const auto _r_index_b = __solution.nodes()[_index_b];
+				const auto _r_index_a = static_cast<size_type>(this->indices_[_index_a]);
+				for (size_type _index_b = static_cast<size_type>(_index_a + 1); _index_b < this->indices_.size(); ++_index_b) {
+					const auto _r_index_b = static_cast<size_type>(this->indices_[_index_b]);
 					if ( (_r_index_a != 0 || _r_index_b != _last_index) && (_r_index_a != _last_index || _r_index_b != 0)) {
 						const auto _gain_cost = __solution.gaincostAfterRouteSwap(__graph, _r_index_a, _r_index_b);
 						if (_gain_cost < _best_gaincost) {
@@ -60,10 +103,16 @@ namespace okl::tsp {
 					}
 				}
 			}
+			//先頭と末尾の組以外の全ての組を評価する
+			OKL_PROFILE_ADD(evaluated_moves_, static_cast<std::uint_least64_t>(_last_index) * (_last_index + 1) / 2 - 1);
 
 			if (_candidate_index_a != std::numeric_limits<size_type>::max() && _candidate_index_b != std::numeric_limits<size_type>::max()) {
 				__solution.routeSwap(__graph, _candidate_index_a, _candidate_index_b, _best_gaincost);
 			}
 		}
+
+	private:
+		//!ルートインデックスの評価順
+		std::vector<std::size_t> indices_;
 	};
 } /* namespace okl::tsp */
\ No newline at end of file
@@ -0,0 +1,281 @@
+﻿#pragma once
+
+#include "../RouteSwapOperator.hpp"
+#include "../../../../Profile/module.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace okl::tsp {
+	/*!
+	 *  @brief      近傍リストルートスワップ関数クラス
+	 *  @details    近傍リストとdon't look bitを用いた即時移動戦略ルートスワップ関数クラス
+	 *				各頂点から近い順に__NeighborNum頂点のみを相手の候補とし，改善できなかった頂点は前後の辺が変わるまで調べない
+	 *				1回の呼び出しで，調べる頂点がなくなるまで改善する移動を適用する
+	 *				調べ始める頂点は解クラスが記録した前後の頂点が変わった頂点とし，呼び出しの終わりに記録を捨てる
+	 *				二重橋摂動の後は繋ぎ変えた8つの端点のみを調べるため，反復局所探索の1反復の準備と近傍評価は巡回路長によらない
+	 *				初期解生成で巡回路全体が変わった場合は全頂点を調べる
+	 *				頂点のルートインデックス表は作業領域として持ち，前回局所最適にした解の続きであれば解が記録した書き換えた範囲のみ更新する
+	 *				別の解であれば求め直すため，遺伝的アルゴリズムで個体ごとに呼び出しても正しく調べる
+	 *				近傍リストは問題例ごとに最初の呼び出しで作成し，サイズ設定で捨てる
+	 *				- __NeighborNum			頂点ごとの近傍リストの長さ
+	 */
+	template<std::size_t __NeighborNum = 8>
+	class NeighborListRouteSwapOperator : public RouteSwapOperator
+	{
+	public:
+		/*!
+		 * @brief				コンストラクタ
+		 */
+		NeighborListRouteSwapOperator() = default;
+
+		/*!
+		 * @brief				デストラクタ
+		 */
+		virtual ~NeighborListRouteSwapOperator() = default;
+
+		using random_device_type = typename RouteSwapOperator::random_device_type;
+		using seed_type = typename RouteSwapOperator::seed_type;
+		using size_type = typename RouteSwapOperator::size_type;
+
+		/*!
+		 * @brief				アルゴリズム名
+		 * @return				std::string	このアルゴリズムの名前を返す
+		 */
+		static const std::string info() { return  "近傍リスト" + std::to_string(__NeighborNum) + RouteSwapOperator::info(); }
+
+		/*!
+		 * @brief			サイズ設定
+		 * @param[in]		__size 頂点数
+		 * @detail			作業配列のメモリ確保を行い，前の問題例の近傍リストを捨てる
+		 */
+		inline virtual void resize(const size_type __size) override
+		{
+			RouteSwapOperator::resize(__size);
+			this->neighbors_.clear();
+			this->neighbors_.reserve(__size * __NeighborNum);
+			this->queue_.reserve(__size);
+			this->is_queued_.assign(__size, 0);
+			this->positions_.clear();
+			this->positions_.reserve(__size);
+			this->positions_stamp_ = 0;
+		}
+
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	近傍リストと作業配列が確保しているヒープ領域[byte]を返す
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->neighbors_) + okl::memorySize(this->positions_) + okl::memorySize(this->queue_) + okl::memorySize(this->is_queued_);
+		}
+
+		/*!
+		 * @brief			クラスに関連付けられた演算を実行
+		 * @detail			クラスに関連付けられた演算を実行する
+		 */
+		template<class __SearchInfo, class __Solution>
+		inline void operator()(const typename __Solution::graph_type& __graph, const __SearchInfo& __search_info, __Solution& __solution, const __Solution& __initial_solution, const __Solution& __best_solution) {
+			using index_type = typename __Solution::index_type;
+			using cost_type = typename __Solution::cost_type;
+			using id_type = typename __Solution::id_type;
+
+			const auto& _route = __solution.route();
+			const index_type _size = _route.size();
+			if (_size < 5) {
+				return;
+			}
+			if (this->neighbors_.size() != _size * std::min<std::size_t>(__NeighborNum, _size - 1)) {
+				this->makeNeighbors(__graph, _size);
+			}
+			const std::size_t _neighbor_num = this->neighbors_.size() / _size;
+
+			//前回局所最適にした巡回路の印が同じなら，その後に解が書き換えた範囲のみ更新する
+			if (this->positions_.size() != _size || __solution.isAllNodesChanged() || __solution.route_stamp() == 0 || __solution.route_stamp() != this->positions_stamp_) {
+				this->positions_.resize(_size);
+				this->setPositions(_route, 0, _size);
+			}
+			else {
+				this->setPositions(_route, __solution.changed_index_first(), __solution.changed_index_last());
+			}
+			const auto& _positions = this->positions_;
+
+			//前後の頂点が変わった頂点のみを調べる 待ち行列に入っているかの印は，呼び出しの終わりにはすべて外れている
+			if (this->is_queued_.size() != _size) {
+				this->is_queued_.assign(_size, 0);
+			}
+			this->queue_.clear();
+			if (__solution.isAllNodesChanged()) {
+				for (index_type _index = 0; _index < _size; ++_index) {
+					this->push(static_cast<std::size_t>(_route[_index]));
+				}
+			}
+			else {
+				for (std::size_t _order = 0; _order < __solution.changed_node_num(); ++_order) {
+					this->push(static_cast<std::size_t>(__solution.changed_nodes()[_order]));
+				}
+			}
+
+			std::uint_least64_t _evaluated_moves = 0;
+			for (std::size_t _head = 0; _head < this->queue_.size(); ++_head) {
+				const auto _node_a = this->queue_[_head];
+				this->is_queued_[_node_a] = 0;
+
+				//a-succ(a)とc-succ(c)を a-cとsucc(a)-succ(c)に，またはpred(a)-aとpred(c)-cを a-cとpred(a)-pred(c)に繋ぎ変える
+				bool _is_improved = false;
+				for (int _direction = 0; _direction < 2 && !_is_improved; ++_direction) {
+					const auto _index_a = static_cast<index_type>(_positions[_node_a]);
+					const auto _side_a = static_cast<std::size_t>(_route[this->step(_index_a, _direction, _size)]);
+					const cost_type _edge_a = __graph.edge(static_cast<id_type>(_node_a), static_cast<id_type>(_side_a));
+					for (std::size_t _order = 0; _order < _neighbor_num; ++_order) {
+						const auto _node_c = this->neighbors_[_node_a * _neighbor_num + _order];
+						//近い順に並んでいるため，a-cがa側の辺より長くなったら以降も改善しない
+						if (_edge_a <= static_cast<cost_type>(__graph.edge(static_cast<id_type>(_node_a), static_cast<id_type>(_node_c)))) {
+							break;
+						}
+						const auto _index_c = static_cast<index_type>(_positions[_node_c]);
+						if (_node_c == _side_a) {
+							continue;
+						}
+						index_type _index_first;
+						index_type _index_last;
+						if (_direction == 0) {
+							_index_first = std::min(_index_a, _index_c) + 1;
+							_index_last = std::max(_index_a, _index_c);
+						}
+						else {
+							_index_first = std::min(_index_a, _index_c);
+							_index_last = std::max(_index_a, _index_c) - 1;
+						}
+						if (_index_last <= _index_first) {
+							continue;
+						}
+						++_evaluated_moves;
+						const auto _gain_cost = __solution.gaincostAfterRouteSwap(__graph, _index_first, _index_last);
+						if (_gain_cost < 0) {
+							const auto _side_c = static_cast<std::size_t>(_route[this->step(_index_c, _direction, _size)]);
+							__solution.routeSwap(__graph, _index_first, _index_last, _gain_cost);
+							this->updatePositions(_route, _index_first, _index_last);
+							this->push(_node_a);
+							this->push(_side_a);
+							this->push(_node_c);
+							this->push(_side_c);
+							_is_improved = true;
+							break;
+						}
+					}
+				}
+			}
+			OKL_PROFILE_ADD(evaluated_moves_, _evaluated_moves);
+
+			//局所最適解に達したため，この呼び出しで変わった頂点の記録も捨て，ルートインデックス表を求めた巡回路として印を覚える
+			__solution.clearChangedNodes();
+			this->positions_stamp_ = __solution.route_stamp();
+		}
+
+	private:
+		//!頂点ごとの近傍リスト 近い順
+		std::vector<std::size_t> neighbors_;
+
+		//!頂点ごとのルートインデックス
+		std::vector<std::size_t> positions_;
+
+		//!ルートインデックス表を求めた巡回路の印 0なら未作成
+		std::uint_least64_t positions_stamp_ = 0;
+
+		//!調べる頂点の待ち行列
+		std::vector<std::size_t> queue_;
+
+		//!待ち行列に入っているか
+		std::vector<char> is_queued_;
+
+		/*!
+		 * @brief			近傍リストを作成する
+		 * @param[in]		__graph グラフクラス
+		 * @param[in]		__size 頂点数
+		 * @detail			同じ距離の頂点はIDの小さい順に並べる
+		 */
+		template<class __Graph>
+		void makeNeighbors(const __Graph& __graph, const std::size_t __size)
+		{
+			using id_type = typename __Graph::id_type;
+
+			const std::size_t _neighbor_num = std::min<std::size_t>(__NeighborNum, __size - 1);
+			this->neighbors_.resize(__size * _neighbor_num);
+			std::vector<std::size_t> _candidates(__size - 1);
+			for (std::size_t _node = 0; _node < __size; ++_node) {
+				std::iota(_candidates.begin(), _candidates.begin() + _node, 0);
+				std::iota(_candidates.begin() + _node, _candidates.end(), _node + 1);
+				const auto _compare = [&__graph, _node](const std::size_t _a, const std::size_t _b) {
+					const auto _edge_a = __graph.edge(static_cast<id_type>(_node), static_cast<id_type>(_a));
+					const auto _edge_b = __graph.edge(static_cast<id_type>(_node), static_cast<id_type>(_b));
+					return _edge_a < _edge_b || (_edge_a == _edge_b && _a < _b);
+				};
+				std::partial_sort(_candidates.begin(), _candidates.begin() + _neighbor_num, _candidates.end(), _compare);
+				std::copy(_candidates.begin(), _candidates.begin() + _neighbor_num, this->neighbors_.begin() + _node * _neighbor_num);
+			}
+		}
+
+		/*!
+		 * @brief			頂点を待ち行列に入れる
+		 * @param[in]		__node 頂点ID
+		 */
+		inline void push(const std::size_t __node)
+		{
+			if (this->is_queued_[__node] == 0) {
+				this->is_queued_[__node] = 1;
+				this->queue_.push_back(__node);
+			}
+		}
+
+		/*!
+		 * @brief			隣のルートインデックスを返す
+		 * @param[in]		__index ルートインデックス
+		 * @param[in]		__direction 0なら次 1なら前
+		 * @param[in]		__size ルート長
+		 * @return			std::size_t	隣のルートインデックスを返す
+		 */
+		static constexpr std::size_t step(const std::size_t __index, const int __direction, const std::size_t __size)
+		{
+			return __direction == 0 ? (__index + 1 == __size ? 0 : __index + 1) : (__index == 0 ? __size - 1 : __index - 1);
+		}
+
+		/*!
+		 * @brief			範囲の頂点のルートインデックスを求める
+		 * @param[in]		__route ルート配列
+		 * @param[in]		__first 範囲の先頭
+		 * @param[in]		__last 範囲の末尾の次 __first以下なら何もしない
+		 */
+		template<class __Route>
+		inline void setPositions(const __Route& __route, const std::size_t __first, const std::size_t __last)
+		{
+			for (std::size_t _index = __first; _index < __last; ++_index) {
+				this->positions_[static_cast<std::size_t>(__route[_index])] = _index;
+			}
+		}
+
+		/*!
+		 * @brief			反転した範囲の頂点のルートインデックスを更新する
+		 * @param[in]		__route ルート配列
+		 * @param[in]		__index_a 反転したルートインデックスA
+		 * @param[in]		__index_b 反転したルートインデックスB
+		 * @detail			Solution::routeSwapと同じく，内側と外側の短い方が反転されている
+		 */
+		template<class __Route>
+		inline void updatePositions(const __Route& __route, const std::size_t __index_a, const std::size_t __index_b)
+		{
+			const std::size_t _size = __route.size();
+			const auto _inner_range_size = (__index_b - __index_a + 1) / 2;
+			const auto _outer_range_size = (__index_a - __index_b - 1 + _size) / 2;
+			if (_inner_range_size < _outer_range_size) {
+				this->setPositions(__route, __index_a, __index_b + 1);
+			}
+			else {
+				this->setPositions(__route, __index_b + 1, _size);
+				this->setPositions(__route, 0, __index_a);
+			}
+		}
+	};
+} /* namespace okl::tsp */
@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "NeighborListRouteSwapOperator.hpp"
\ No newline at end of file
@@ -1,3 +1,4 @@
 ﻿#pragma once
 #include "RouteSwapOperator.hpp"
-#include "BestImprovementRouteSwapOperator/module.hpp"
\ No newline at end of file
+#include "BestImprovementRouteSwapOperator/module.hpp"
+#include "NeighborListRouteSwapOperator/module.hpp"
\ No newline at end of file
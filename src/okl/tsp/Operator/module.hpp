@@ -1,3 +1,4 @@
 ﻿#pragma once
 #include "RouteSwapOperator/module.hpp"
 #include "RouteOrderOperator/module.hpp"
+#include "PerturbationOperator/module.hpp"
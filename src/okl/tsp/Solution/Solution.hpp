@@ -1,12 +1,23 @@
 ﻿#pragma once
 #include <vector>
+#include <array>
 #include <limits>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include "../../HashSet/module.hpp"
+#include "../../Profile/module.hpp"
+#include "../Tour/module.hpp"
 
 namespace okl::tsp {
 	/*!
 	 *  @brief      巡回セールスマン問題に対する解クラス
 	 *  @details    巡回セールスマン問題に対する解クラス
+	 *				ノードID集合は問題例ごとに同じであるため，複製した解の間で変更不可として共有する
+	 *				ランダムな順序が必要な演算は，演算クラスごとに並び替え用の配列を持つこと
+	 *				前後のノードが変わったノードと書き換えたルートインデックスの範囲を記録し，局所探索が前回の局所最適解から変わった箇所のみを調べられるようにする
+	 *				局所最適解ごとに巡回路に印を付け，局所探索クラスが持つノードのルートインデックス表がどの巡回路から求めたものかを判定できるようにする
 	 *				- __Graph				グラフクラス
 	 *				- __Cost				コスト数値型
 	 *				- __IdContainer			IDメディアンクラス
@@ -22,7 +33,18 @@ namespace okl::tsp {
 		/*!
 		 * @brief				コンストラクタ
 		 */
-		Solution() : cost_(std::numeric_limits<cost_type>::max()), order_number_(0) {};
+		Solution() : cost_(std::numeric_limits<cost_type>::max()), order_number_(0), changed_node_num_(all_changed), changed_index_first_(std::numeric_limits<index_type>::max()), changed_index_last_(0), route_stamp_(0) {};
+
+		/*!
+		 * @brief				コピーコンストラクタ
+		 */
+		Solution(const Solution&) = default;
+
+		/*!
+		 * @brief				ムーブコンストラクタ
+		 * @detail				ルート配列とノード集合の領域を引き継ぐ
+		 */
+		Solution(Solution&&) noexcept = default;
 
 		/*!
 			 * @brief				デストラクタ
@@ -45,6 +67,10 @@ namespace okl::tsp {
 		using route_container_type = __RouteContainer;
 		using set_type = __Set;
 		using cost_comparison_function = std::greater<cost_type>;
+		using stamp_type = std::uint_least64_t;
+
+		//!記録できる前後のノードが変わったノードの数 二重橋摂動2回分
+		static constexpr std::size_t max_changed_node_num = 16;
 
 		/*!
 		 * @brief			解の値を返す
@@ -66,19 +92,84 @@ namespace okl::tsp {
 		{
 			this->cost_ = std::numeric_limits<cost_type>::max();
 			this->order_number_ = 0;
-			this->nodes_.clear();
+			this->nodes_.reset();
 			std::fill(this->route_.begin(), this->route_.end(), this->undefine_id());
+			this->invalidateRoute();
+		}
+
+		/*!
+		 * @brief			未評価の状態にする
+		 * @detail			コストと巡回数のみ初期化し，ルート配列とノード集合は書き換えない
+		 *					探索クラスが保持する初期解と最良解を試行や局所探索ごとに初期化するために用いる
+		 *					ルート配列は次の代入で上書きされるため，clear関数のように埋め直さない
+		 */
+		inline void invalidate()
+		{
+			this->cost_ = std::numeric_limits<cost_type>::max();
+			this->order_number_ = 0;
+		}
+
+		/*!
+		 * @brief			初期解の状態に戻す
+		 * @param[in]		__initial_solution 初期解
+		 * @detail			再スタートで初期解を代入する代わりに用いる
+		 *					巡回済みの範囲のルート配列のみ複製し，残りはsetRouteOrderで上書きされるため複製しない
+		 *					ノード集合は共有する
+		 */
+		inline void reset(const Solution& __initial_solution)
+		{
+			this->cost_ = __initial_solution.cost_;
+			this->order_number_ = __initial_solution.order_number_;
+			if (this->route_.size() != __initial_solution.route_.size()) {
+				this->route_ = __initial_solution.route_;
+			}
+			else {
+				std::copy_n(__initial_solution.route_.begin(), this->order_number_, this->route_.begin());
+			}
+			this->nodes_ = __initial_solution.nodes_;
+			this->invalidateRoute();
+		}
+
+		/*!
+		 * @brief			解を交換する
+		 * @param[in,out]	__other 交換対象
+		 * @detail			ルート配列とノード集合を領域ごと交換するため，要素の複製は行わない
+		 */
+		inline void swap(Solution& __other) noexcept
+		{
+			std::swap(this->cost_, __other.cost_);
+			std::swap(this->order_number_, __other.order_number_);
+			this->route_.swap(__other.route_);
+			this->nodes_.swap(__other.nodes_);
+			std::swap(this->changed_nodes_, __other.changed_nodes_);
+			std::swap(this->changed_node_num_, __other.changed_node_num_);
+			std::swap(this->changed_index_first_, __other.changed_index_first_);
+			std::swap(this->changed_index_last_, __other.changed_index_last_);
+			std::swap(this->route_stamp_, __other.route_stamp_);
 		}
 
 		/*!
 		 * @brief			サイズ設定
 		 * @param[in]		__size 頂点数
 		 * @detail			全要素をメモリ確保を行う
+		 *					ノードID集合は共有するため，addNodeで最初に追加するときに確保する
 		 */
 		inline void resize(const size_type __size)
 		{
 			this->route_.resize(__size, this->undefine_id());
-			this->nodes_.reserve(__size);
+			this->invalidateRoute();
+		}
+
+		/*!
+		 * @brief			ルート配列を連続領域のブロックに結び付ける
+		 * @param[in]		__data ブロックの先頭 nullptrなら結び付けを解除する
+		 * @param[in]		__capacity ブロックに格納できる要素数
+		 * @detail			ルート配列型がArenaVectorの場合のみ用いる
+		 *					母集団の個体の巡回路を1つの連続領域にまとめるために用いる
+		 */
+		inline void bindRoute(id_type* __data, const size_type __capacity)
+		{
+			this->route_.bind(__data, __capacity);
 		}
 
 		/*!
@@ -96,10 +187,18 @@ namespace okl::tsp {
 		 * @param[in]		__graph グラフクラス
 		 * @param[in]		__node_id 探索頂点として追加する頂点ID
 		 * @detail			閉鎖メディアン集合に探索頂点追加する
+		 *					問題の読み込み時のみに行う ノードID集合を他の解と共有している場合は複製してから追加する
 		 */
 		inline void addNode(const node_type __node_id)
 		{
-			this->nodes_.insert(__node_id);
+			if (!this->nodes_) {
+				this->nodes_ = std::make_shared<set_type>();
+				this->nodes_->reserve(static_cast<typename set_type::size_type>(this->route_.size()));
+			}
+			else if (1 < this->nodes_.use_count()) {
+				this->nodes_ = std::make_shared<set_type>(*this->nodes_);
+			}
+			this->nodes_->insert(__node_id);
 		}
 
 		/*!
@@ -113,6 +212,7 @@ namespace okl::tsp {
 			assert(this->order_number_ < this->route_.size());
 			this->route_[this->order_number_] = __node_id;
 			++this->order_number_;
+			this->invalidateRoute();
 		}
 
 		/*!
@@ -144,9 +244,23 @@ namespace okl::tsp {
 				std::swap(__index_a, __index_b);
 			}
 
+			OKL_PROFILE_ADD(applied_moves_, 1);
 			this->cost_ += __gain_cost;
 			const auto _inner_range_size = (__index_b - __index_a + 1) / 2;
 			const auto _outer_range_size = (__index_a - __index_b - 1 +  this->route().size()) / 2;
+			//繋ぎ変える2本の辺の端点の前後が変わる 外側を反転する場合は両端を書き換える
+			if (this->reserveChangedNodes(4)) {
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_a == 0 ? this->route().size() - 1 : __index_a - 1];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_a];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_b];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_b + 1 == this->route().size() ? 0 : __index_b + 1];
+				if (_inner_range_size < _outer_range_size) {
+					this->recordChangedRange(__index_a, __index_b + 1);
+				}
+				else {
+					this->recordChangedRange(0, this->route().size());
+				}
+			}
 			if (_inner_range_size < _outer_range_size) {
 				for (index_type _order = 0; _order < _inner_range_size; ++_order)
 				{
@@ -222,36 +336,83 @@ namespace okl::tsp {
 		}
 
 		/*!
-		 * @brief			ノード集合の参照を返す
-		 * @return			set_type&		ノードID集合の参照を返す
-		 * @detail			ノード集合 の参照を返す
-		 *					set_typeはテンプレート__Setにより定義される
+		 * @brief			二重橋
+		 * @param[in]		__graph グラフクラス
+		 * @param[in]		__index_a 区間Xの先頭ルートインデックス
+		 * @param[in]		__index_b 区間Yの先頭ルートインデックス
+		 * @param[in]		__index_c 区間Zの先頭ルートインデックス
+		 * @param[in]		__index_d 区間Zの末尾の次のルートインデックス
+		 * @param[in]		__gain_cost 二重橋を行った場合のゲインコスト
+		 * @detail			連続する3区間X=[a,b) Y=[b,c) Z=[c,d)の並びをZ Y Xにする 各区間の向きは変えない
+		 *					区間の外側の残りを含めた4本の辺を繋ぎ変える　書き換えるのは[a,d)のみ
+		 *					a < b < c < d <= ルート長で，区間の外側に1頂点以上残ること
+		 *					繋ぎ変えた辺の8つの端点を前後のノードが変わったノードとして，[a,d)を書き換えた範囲として記録する
 		 */
-		inline const set_type& nodes() const
+		inline void routeDoubleBridge(const __Graph& __graph, const index_type __index_a, const index_type __index_b, const index_type __index_c, const index_type __index_d, const cost_type __gain_cost)
 		{
-			return this->nodes_;
+			assert(__index_a < __index_b && __index_b < __index_c && __index_c < __index_d && __index_d <= this->route().size());
+			assert(__index_d - __index_a < this->route().size());
+
+			OKL_PROFILE_ADD(applied_moves_, 1);
+			this->cost_ += __gain_cost;
+			if (this->reserveChangedNodes(8)) {
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_a == 0 ? this->route().size() - 1 : __index_a - 1];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_a];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_b - 1];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_b];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_c - 1];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_c];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_d - 1];
+				this->changed_nodes_[this->changed_node_num_++] = this->route_[__index_d == this->route().size() ? 0 : __index_d];
+				this->recordChangedRange(__index_a, __index_d);
+			}
+			//全体を反転してZ' Y' X'とし，各区間を反転し直す
+			const auto _first = this->route_.begin();
+			std::reverse(_first + __index_a, _first + __index_d);
+			const auto _index_y = __index_a + (__index_d - __index_c);
+			const auto _index_x = _index_y + (__index_c - __index_b);
+			std::reverse(_first + __index_a, _first + _index_y);
+			std::reverse(_first + _index_y, _first + _index_x);
+			std::reverse(_first + _index_x, _first + __index_d);
 		}
 
 		/*!
-		 * @brief			ノード集合をシャッフルする
-		 * @param[in]		__generator ランダム生成機
-		 * @detail			要素をランダム生成機を使用しシャッフルする
+		 * @brief			二重橋を行った場合のコスト差
+		 * @param[in]		__graph グラフクラス
+		 * @param[in]		__index_a 区間Xの先頭ルートインデックス
+		 * @param[in]		__index_b 区間Yの先頭ルートインデックス
+		 * @param[in]		__index_c 区間Zの先頭ルートインデックス
+		 * @param[in]		__index_d 区間Zの末尾の次のルートインデックス
+		 * @return			cost_type		コスト差を返す
+		 * @detail			routeDoubleBridge関数を行った場合のコスト差を返す
+		 *					二重橋そのものは行わない
 		 */
-		template<typename _UniformRandomNumberGenerator>
-		inline void shuffleNodes(_UniformRandomNumberGenerator& __generator)
+		constexpr cost_type gaincostAfterRouteDoubleBridge(const __Graph& __graph, const index_type __index_a, const index_type __index_b, const index_type __index_c, const index_type __index_d) const
 		{
-			this->nodes_.shuffle(__generator);
+			const auto _prev = this->route_[__index_a == 0 ? this->route().size() - 1 : __index_a - 1];
+			const auto _next = this->route_[__index_d == this->route().size() ? 0 : __index_d];
+			const auto _x_first = this->route_[__index_a];
+			const auto _x_last = this->route_[__index_b - 1];
+			const auto _y_first = this->route_[__index_b];
+			const auto _y_last = this->route_[__index_c - 1];
+			const auto _z_first = this->route_[__index_c];
+			const auto _z_last = this->route_[__index_d - 1];
+
+			return (static_cast<cost_type>(__graph.edge(_prev, _z_first)) + __graph.edge(_z_last, _y_first) + __graph.edge(_y_last, _x_first) + __graph.edge(_x_last, _next))
+				- (static_cast<cost_type>(__graph.edge(_prev, _x_first)) + __graph.edge(_x_last, _y_first) + __graph.edge(_y_last, _z_first) + __graph.edge(_z_last, _next));
 		}
 
 		/*!
-		 * @brief			開設メディアン集合をソートする
-		 * @param[in]		__graph グラフクラス
-		 * @param[in]		__node_id 指定ノードID
-		 * @detail			開設メディアン集合をソートを指定の近い順する
+		 * @brief			ノード集合の参照を返す
+		 * @return			set_type&		ノードID集合の参照を返す
+		 * @detail			ノード集合 の参照を返す
+		 *					ノード集合は他の解と共有しているため変更できない
+		 *					set_typeはテンプレート__Setにより定義される
 		 */
-		inline void sortOpeningMedians(const __Graph& __graph, const node_type __node_id)
+		inline const set_type& nodes() const
 		{
-			this->nodes_.sort([&__graph, __node_id](const id_type& __left_vertex, const id_type& __right_vertex) {return __graph.edge(__node_id, __left_vertex) < __graph.edge(__node_id, __right_vertex); });
+			static const set_type _empty_nodes;
+			return this->nodes_ ? *this->nodes_ : _empty_nodes;
 		}
 
 		/*!
@@ -265,6 +426,89 @@ namespace okl::tsp {
 			return this->route_;
 		}
 
+		/*!
+		 * @brief			全ノードの前後が変わったか判定する
+		 * @return			bool	ルートを作り直したか，記録できる数を超えてノードの前後が変わったならTrue
+		 */
+		inline bool isAllNodesChanged() const
+		{
+			return this->changed_node_num_ == all_changed;
+		}
+
+		/*!
+		 * @brief			前後のノードが変わったノードの数を返す
+		 * @return			std::size_t	clearChangedNodes関数の後に前後のノードが変わったノードの数を返す 重複を含む
+		 * @detail			isAllNodesChanged関数がFalseの場合のみ有効
+		 */
+		inline std::size_t changed_node_num() const
+		{
+			return this->changed_node_num_;
+		}
+
+		/*!
+		 * @brief			前後のノードが変わったノードを返す
+		 * @return			std::array		前後のノードが変わったノードIDの配列を返す 先頭からchanged_node_num関数の数のみ有効
+		 */
+		inline const std::array<id_type, max_changed_node_num>& changed_nodes() const
+		{
+			return this->changed_nodes_;
+		}
+
+		/*!
+		 * @brief			書き換えたルートインデックスの範囲の先頭を返す
+		 * @return			index_type	clearChangedNodes関数の後に書き換えた範囲[first,last)の先頭を返す 書き換えていなければlast以上
+		 * @detail			isAllNodesChanged関数がFalseの場合のみ有効
+		 */
+		inline index_type changed_index_first() const
+		{
+			return this->changed_index_first_;
+		}
+
+		/*!
+		 * @brief			書き換えたルートインデックスの範囲の末尾の次を返す
+		 * @return			index_type	clearChangedNodes関数の後に書き換えた範囲[first,last)の末尾の次を返す
+		 * @detail			isAllNodesChanged関数がFalseの場合のみ有効
+		 */
+		inline index_type changed_index_last() const
+		{
+			return this->changed_index_last_;
+		}
+
+		/*!
+		 * @brief			巡回路の印を返す
+		 * @return			stamp_type	最後にclearChangedNodes関数を呼び出したときの巡回路の印を返す 0なら未設定
+		 * @detail			印は解の型ごとに一意で，複製した解にも引き継ぐ
+		 *					印が同じ解の巡回路は，印を付けた時点の巡回路から記録した範囲のみ書き換えたものになる
+		 */
+		inline stamp_type route_stamp() const
+		{
+			return this->route_stamp_;
+		}
+
+		/*!
+		 * @brief			前後のノードが変わったノードの記録を捨てる
+		 * @detail			局所探索が局所最適解に達した後に呼び出す
+		 *					この時点の巡回路に新しい印を付ける
+		 */
+		inline void clearChangedNodes()
+		{
+			this->changed_node_num_ = 0;
+			this->changed_index_first_ = std::numeric_limits<index_type>::max();
+			this->changed_index_last_ = 0;
+			this->route_stamp_ = newRouteStamp();
+		}
+
+		/*!
+		 * @brief			解を出力ストリームに書き込む
+		 * @param[out]		__out 出力ストリーム
+		 * @param[in]		__name 解の名前
+		 * @detail			巡回路をTSPLIBのTOUR形式で書き込む
+		 */
+		inline void write(std::ostream& __out, const std::string& __name) const
+		{
+			writeTour(__out, __name, this->route(), this->cost());
+		}
+
 		void check(const __Graph& __graph) {
 			const std::size_t _last_index = this->route().size() - 1;
 			cost_type ccc = __graph.edge(this->route()[0], this->route()[_last_index]);
@@ -293,15 +537,27 @@ namespace okl::tsp {
 		*/
 		inline Solution& operator=(const Solution& __other)
 		{
+			OKL_PROFILE_ADD(solution_copies_, 1);
 			this->cost_ = __other.cost_;
 			this->order_number_ = __other.order_number_;
 			this->route_ = __other.route_;
-			if (this->nodes_.size() != __other.nodes_.size()) {
-				this->nodes_ = __other.nodes_;
-			}
+			this->nodes_ = __other.nodes_;
+			this->changed_nodes_ = __other.changed_nodes_;
+			this->changed_node_num_ = __other.changed_node_num_;
+			this->changed_index_first_ = __other.changed_index_first_;
+			this->changed_index_last_ = __other.changed_index_last_;
+			this->route_stamp_ = __other.route_stamp_;
 			return *this;
 		}
 
+		/*!
+		* @brief			ムーブ代入処理を行う
+		* @param[in]		__other 代入元対象
+		* @return			Solution&	自分自身の参照を返す
+		* @detail			ルート配列とノード集合の領域を引き継ぐ
+		*/
+		Solution& operator=(Solution&&) noexcept = default;
+
 		//比較演算子
 		constexpr bool operator<(const Solution& __other) const
 		{
@@ -328,6 +584,16 @@ namespace okl::tsp {
 			return !(*this == __other);
 		}
 
+		/*!
+		 * @brief			確保しているメモリ量を返す
+		 * @return			std::size_t	巡回路が確保しているヒープ領域[byte]を返す
+		 * @detail			共有しているノードID集合は含まない
+		 */
+		inline std::size_t memory_size() const
+		{
+			return okl::memorySize(this->route_);
+		}
+
 	protected:
 		/*!
 		 * @brief			巡回路のコストを計算する
@@ -349,6 +615,54 @@ namespace okl::tsp {
 			return std::numeric_limits<id_type>::max();
 		}
 
+		/*!
+		 * @brief			ルートを作り直した状態にする
+		 * @detail			全ノードの前後が変わったとする
+		 */
+		inline void invalidateRoute()
+		{
+			this->changed_node_num_ = all_changed;
+		}
+
+		/*!
+		 * @brief			書き換えたルートインデックスの範囲を記録する
+		 * @param[in]		__first 書き換えた範囲の先頭
+		 * @param[in]		__last 書き換えた範囲の末尾の次
+		 * @detail			記録済みの範囲と合わせた範囲にする
+		 */
+		inline void recordChangedRange(const index_type __first, const index_type __last)
+		{
+			this->changed_index_first_ = std::min(this->changed_index_first_, __first);
+			this->changed_index_last_ = std::max(this->changed_index_last_, __last);
+		}
+
+		/*!
+		 * @brief			新しい巡回路の印を返す
+		 * @return			stamp_type	解の型ごとに一意な0以外の印を返す
+		 * @detail			スレッドごとの局所探索が同じ印を付けないよう，解の型ごとに1つの計数器から払い出す
+		 */
+		static stamp_type newRouteStamp()
+		{
+			static std::atomic<stamp_type> _stamp{ 0 };
+			return _stamp.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		/*!
+		 * @brief			前後のノードが変わったノードを記録する空きがあるか判定する
+		 * @param[in]		__num 記録するノードの数
+		 * @return			bool	__num個記録できるならTrue
+		 * @detail			記録できる数を超えるなら全ノードの前後が変わったとする
+		 *					全ノードの前後が変わった後は記録しないため，ノードの前後を書き換え続ける局所探索の負担にならない
+		 */
+		inline bool reserveChangedNodes(const std::size_t __num)
+		{
+			if (this->changed_node_num_ <= max_changed_node_num - __num) {
+				return true;
+			}
+			this->changed_node_num_ = all_changed;
+			return false;
+		}
+
 	private:
 		//!コスト
 		cost_type cost_;
@@ -359,8 +673,26 @@ namespace okl::tsp {
 		//!素集合データセットのIDに対する開設しているメディアン
 		route_container_type route_;
 
-		//!ノードID集合
-		__Set nodes_;
+		//!ノードID集合 同じ問題例の解の間で共有する
+		std::shared_ptr<__Set> nodes_;
+
+		//!前後のノードが変わったノード
+		std::array<id_type, max_changed_node_num> changed_nodes_;
+
+		//!前後のノードが変わったノードの数 all_changedなら全ノード
+		std::size_t changed_node_num_;
+
+		//!書き換えたルートインデックスの範囲の先頭
+		index_type changed_index_first_;
+
+		//!書き換えたルートインデックスの範囲の末尾の次
+		index_type changed_index_last_;
+
+		//!最後に局所最適解に達したときの巡回路の印
+		stamp_type route_stamp_;
+
+		//!全ノードの前後が変わったことを表す数
+		static constexpr std::size_t all_changed = std::numeric_limits<std::size_t>::max();
 	};
 } /* namespace okl::tsp */
 
@@ -0,0 +1,85 @@
+﻿#pragma once
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace okl::tsp {
+	/*!
+	* @brief			巡回路をTSPLIBのTOUR形式で書き込む
+	* @param[out]		__out			出力ストリーム
+	* @param[in]		__name			巡回路名
+	* @param[in]		__route			巡回順の頂点ID列 頂点IDは0始まり
+	* @param[in]		__cost			巡回路長 COMMENTに書き込む
+	* @detail			頂点IDは1始まりに変換して書き込む
+	*/
+	template<class __Route, class __Cost>
+	void writeTour(std::ostream& __out, const std::string& __name, const __Route& __route, const __Cost __cost)
+	{
+		__out << "NAME : " << __name << "\n";
+		__out << "TYPE : TOUR\n";
+		__out << "COMMENT : Length = " << __cost << "\n";
+		__out << "DIMENSION : " << __route.size() << "\n";
+		__out << "TOUR_SECTION\n";
+		for (const auto _id : __route) {
+			__out << static_cast<std::size_t>(_id) + 1 << "\n";
+		}
+		__out << "-1\nEOF\n";
+	}
+
+	/*!
+	* @brief			TSPLIBのTOUR形式の巡回路を読み込む
+	* @param[in]		__path			巡回路ファイルパス
+	* @param[out]		__route			巡回順の頂点ID列 頂点IDは0始まり
+	* @return			bool			各頂点をちょうど1回ずつ巡回する巡回路を読み込めたらtrueを返す
+	* @detail			DIMENSIONが指定されていれば頂点数と一致するか判定する
+	*					読み込めなかった場合__routeの内容は不定
+	*/
+	template<class __Id>
+	bool loadTour(const std::string& __path, std::vector<__Id>& __route)
+	{
+		std::ifstream _fin(__path);
+		if (_fin.fail()) {
+			return false;
+		}
+
+		std::size_t _dimension = 0;
+		std::string _baffer = "";
+		while (std::getline(_fin, _baffer))
+		{
+			//空白とタブを区別せずに取り除く
+			_baffer.erase(std::remove_if(_baffer.begin(), _baffer.end(), [](const unsigned char __char) { return std::isspace(__char) != 0; }), _baffer.end());
+			if (_baffer.find("TOUR_SECTION") != std::string::npos) {
+				break;
+			}
+			const std::string _dimension_str = "DIMENSION:";
+			if (_baffer.find(_dimension_str) != std::string::npos) {
+				std::istringstream _stream(_baffer.substr(_dimension_str.size()));
+				_stream >> _dimension;
+			}
+		}
+
+		__route.clear();
+		long long _id;
+		while (_fin >> _id && _id != -1) {
+			if (_id < 1) {
+				return false;
+			}
+			__route.push_back(static_cast<__Id>(_id - 1));
+		}
+
+		if (__route.empty() || (_dimension != 0 && _dimension != __route.size())) {
+			return false;
+		}
+		std::vector<bool> _visited(__route.size(), false);
+		for (const auto _node_id : __route) {
+			if (__route.size() <= static_cast<std::size_t>(_node_id) || _visited[_node_id]) {
+				return false;
+			}
+			_visited[_node_id] = true;
+		}
+		return true;
+	}
+} /* namespace okl::tsp */
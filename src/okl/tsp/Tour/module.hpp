@@ -0,0 +1,2 @@
+﻿#pragma once
+#include "Tour.hpp"
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "../../Vertex/module.hpp"
+#include <cassert>
 #include <complex>
 
 namespace okl::tsp {
@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "Load/module.hpp"
+#include "Generate/module.hpp"
 #include "Vertex/module.hpp"
+#include "Tour/module.hpp"
 #include "Solution/module.hpp"
 #include "Operator/module.hpp"
\ No newline at end of file
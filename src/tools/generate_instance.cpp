@@ -0,0 +1,42 @@
+﻿#include <fstream>
+#include <iostream>
+#include "../okl/module.hpp"
+
+//指定した配置と頂点数の巡回セールスマン問題をTSPLIB形式で生成する
+//同じ引数なら同じ問題例を生成する
+int main(int argc, char* argv[]) {
+	okl::CommandLine cmd;
+	cmd.addOption("distribution", 'd', "uniform", "配置 uniform, clustered, grid");
+	cmd.addOption("size", 'n', "1000", "頂点数");
+	cmd.addOption("seed", ' ', "1", "シード");
+	cmd.addOption("type", ' ', "EUC_2D", "距離の種類 EUC_2D, EUC_2D_REAL EUC_2D_REALなら実数座標");
+	cmd.addOption("width", ' ', "10000", "配置範囲の幅");
+	cmd.addOption("name", ' ', "", "問題例名 空なら<配置><頂点数>_<シード>");
+	cmd.addOption("output", 'o', "", "出力ファイルパス 空なら標準出力");
+	cmd.parse(argc, argv);
+
+	const auto _type = cmd.getParameter("type");
+	if (_type != "EUC_2D" && _type != "EUC_2D_REAL") {
+		std::cerr << "unsupported type " << _type << std::endl;
+		return 1;
+	}
+	const auto _positions = okl::tsp::generatePositions(cmd.getParameter("distribution"), std::stoul(cmd.getParameter("size")), static_cast<std::seed_seq::result_type>(std::stoul(cmd.getParameter("seed"))), std::stoul(cmd.getParameter("width")), _type == "EUC_2D_REAL");
+	if (_positions.empty()) {
+		std::cerr << "unsupported distribution or size " << cmd.getParameter("distribution") << " " << cmd.getParameter("size") << std::endl;
+		return 1;
+	}
+
+	std::ofstream _file;
+	if (!cmd.getParameter("output").empty()) {
+		_file.open(cmd.getParameter("output"));
+		if (!_file) {
+			std::cerr << "cannot open " << cmd.getParameter("output") << std::endl;
+			return 1;
+		}
+	}
+	std::ostream& _out = cmd.getParameter("output").empty() ? std::cout : _file;
+
+	const auto _name = cmd.getParameter("name").empty() ? cmd.getParameter("distribution") + cmd.getParameter("size") + "_" + cmd.getParameter("seed") : cmd.getParameter("name");
+	okl::tsp::writeInstance(_out, _name, _positions, _type);
+	return 0;
+}
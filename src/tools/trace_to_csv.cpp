@@ -0,0 +1,29 @@
+﻿#include <fstream>
+#include <iostream>
+#include "../okl/module.hpp"
+
+//バイナリ形式の履歴ログ(_log_.bin)をテキスト形式の履歴ログ(_log_.csv)と同じCSVに変換する
+int main(int argc, char* argv[]) {
+	okl::CommandLine cmd;
+	cmd.addOption("input", 'i', "", "バイナリ履歴ログファイルパス");
+	cmd.addOption("output", 'o', "", "CSV出力ファイルパス 空なら標準出力");
+	cmd.parse(argc, argv);
+
+	std::ifstream _in(cmd.getParameter("input"), std::ios_base::in | std::ios_base::binary);
+	if (!_in) {
+		std::cerr << "cannot open " << cmd.getParameter("input") << std::endl;
+		return 1;
+	}
+
+	std::ofstream _file;
+	if (!cmd.getParameter("output").empty()) {
+		_file.open(cmd.getParameter("output"));
+	}
+	std::ostream& _out = cmd.getParameter("output").empty() ? std::cout : _file;
+
+	if (!okl::writeBinaryTraceAsCsv(_in, _out)) {
+		std::cerr << "invalid trace " << cmd.getParameter("input") << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -2,68 +2,195 @@
 #include "okl/module.hpp"
 
 namespace okl::tsp {
-	//using id_type = std::uint_least8_t;		//     1 <= _ <=        256
-	using id_type = std::uint_least16_t;		//   257 <= _ <=      65535
-	//using id_type = std::uint_least32_t;		// 65536 <= _ <= 4294957295
-	using edge_type = std::uint_least16_t;
-	using degree_type = okl::make_twice_byte_t<id_type>;
-	using cost_type = std::int_least64_t;
+	/*!
+	 *  @brief      ̌^ꎮ
+	 *  @details    _ID^ƂɒŤ^ꎮ`
+	 *				ID̍ől͖`IDɗp邽߁C_ID̍őlȉł邱
+	 *				- __Id				_ID^
+	 */
+	template<typename __Id>
+	struct Types
+	{
+		using id_type = __Id;
+		using edge_type = std::uint_least16_t;
+		using degree_type = okl::make_twice_byte_t<id_type>;
+		using cost_type = std::int_least64_t;
 
-	using vertex_type = okl::tsp::Vertex<id_type, double>;
+		using vertex_type = okl::tsp::Vertex<id_type, double>;
 
-	using stack_type = okl::Stack<id_type>;
-	using set_type = okl::HashSet<id_type>;
+		using stack_type = okl::Stack<id_type>;
+		using set_type = okl::HashSet<id_type>;
 
-	using graph_type = okl::MatrixGraph<vertex_type, edge_type, degree_type, std::vector<vertex_type>, SymmetricMatrix<edge_type, std::uint_fast64_t>>;
+		//s͑傫ȖTLB~X邽߁Cq[Wy[WŊmۂł悤ɂ
+		using graph_type = okl::MatrixGraph<vertex_type, edge_type, degree_type, std::vector<vertex_type>, SymmetricMatrix<edge_type, std::uint_fast64_t, std::vector<edge_type, okl::HugePageAllocator<edge_type>>>>;
 
-	using solution_type = okl::tsp::Solution<graph_type, cost_type, set_type>;
+		using solution_type = okl::tsp::Solution<graph_type, cost_type, set_type>;
 
+		//Wč̂̏H1̘Äɂ܂Ƃ߂ꍇ̉ƕWc
+		using arena_solution_type = okl::tsp::Solution<graph_type, cost_type, set_type, okl::ArenaVector<id_type>>;
+		template<std::size_t __MaxPopulationSize>
+		using arena_population_type = okl::ArenaPopulation<arena_solution_type, __MaxPopulationSize>;
 
-	using instance_type = okl::Instance<cost_type>;
 
-	using cost_comparison_function = typename solution_type::cost_comparison_function;
+		using instance_type = okl::Instance<cost_type>;
 
-	using result_type = okl::Result<cost_type, cost_comparison_function>;
+		using cost_comparison_function = typename solution_type::cost_comparison_function;
 
-	using info_type = std::tuple<cost_type, double, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t>;
+		using result_type = okl::Result<cost_type, cost_comparison_function>;
+
+		using info_type = std::tuple<cost_type, double, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t>;
 
-	using search_info_type = okl::SearchInfo<result_type, info_type>;
+		using search_info_type = okl::SearchInfo<result_type, info_type>;
+
+		//̑--------------------------------------------------------------------------------------------------------------------------------------
 
-	//̑--------------------------------------------------------------------------------------------------------------------------------------
-
-	//ǏTJEg@͗p
-	using ls_count = okl::CountKeyOperator<0>;
-
-	//-----------------------------------------------------------------------------------------------------------------------------------------
-	//ŗǉǂȂĂ
-	using best_cost_is_better_than_before = okl::CostIsBetterThanBefore<cost_type, cost_comparison_function>;
-
-	//ŗǉǂȂĂȂȂ
-	using not_best_cost_is_better_than_before = okl::NotCondition<best_cost_is_better_than_before>;
-
-	//w񐔌JԂȂ
-	using reached_repeat_times = okl::ReachedRepeatTimes;
-
-	//m̍ŗǉZo
-	using calculated_best_known_cost = okl::CalculatedBestKnownCost;
-
-	//m̍ŗǉZo܂͎w񐔌JԂȂ
-	using reached_repeat_times_or_calculated_best_known_cost = okl::OrCondition<reached_repeat_times, calculated_best_known_cost>;
-
-	//---------------------------------------------------------------------------------------------------------------------------------------------
-
-	using start = okl::tsp::RandomRouteOrderOperator;
-	//using start = okl::tsp::NearestNeighborRouteOrderOperator<set_type>;
-
-	using end_condition = okl::OrCondition< okl::OrCondition<okl::TimerCondition, calculated_best_known_cost>, okl::ReachedRepeatTimes>;
-	//using end_condition = best_cost_is_better_then_best_known_cost;
-	//using end_condition = reached_repeat_times_or_calculated_best_known_cost;
-
-	using _ls = okl::LocalSearch < solution_type, okl::tsp::BestImprovementRouteSwapOperator, not_best_cost_is_better_than_before>;
-
-	using ls = okl::SearchPrePostOperator<ls_count, _ls, okl::NoneOperator>;
-
-	using mls = okl::MultiStartLocalSearch<ls, start, start, end_condition>;
-
-	using search = mls;
+		//ǏTJEg@͗p
+		using ls_count = okl::CountKeyOperator<0>;
+
+		//-----------------------------------------------------------------------------------------------------------------------------------------
+		//ŗǉǂȂĂ
+		using best_cost_is_better_than_before = okl::CostIsBetterThanBefore<cost_type, cost_comparison_function>;
+
+		//ŗǉǂȂĂȂȂ
+		using not_best_cost_is_better_than_before = okl::NotCondition<best_cost_is_better_than_before>;
+
+		//w񐔌JԂȂ
+		using reached_repeat_times = okl::ReachedRepeatTimes;
+
+		//m̍ŗǉZo
+		using calculated_best_known_cost = okl::CalculatedBestKnownCost;
+
+		//m̍ŗǉZo܂͎w񐔌JԂȂ
+		using reached_repeat_times_or_calculated_best_known_cost = okl::OrCondition<reached_repeat_times, calculated_best_known_cost>;
+
+		//---------------------------------------------------------------------------------------------------------------------------------------------
+
+		using start = okl::tsp::RandomRouteOrderOperator;
+		//using start = okl::tsp::NearestNeighborRouteOrderOperator<set_type>;
+		//Ht@CJn t@CȂ΃_
+		using tour_start = okl::tsp::TourRouteOrderOperator;
+
+		using end_condition = okl::OrCondition< okl::OrCondition<okl::TimerCondition, calculated_best_known_cost>, okl::ReachedRepeatTimes>;
+		//using end_condition = best_cost_is_better_then_best_known_cost;
+		//using end_condition = reached_repeat_times_or_calculated_best_known_cost;
+
+		using _ls = okl::LocalSearch < solution_type, okl::tsp::BestImprovementRouteSwapOperator, not_best_cost_is_better_than_before>;
+
+		using ls = okl::SearchPrePostOperator<ls_count, _ls, okl::NoneOperator>;
+
+		//iKƂ̌v OKL_PROFILE`ăRpC_profile_.csvɏ
+		//ǏT̃n[hEFAJE^l͐ݒperf_counter1Ȃ_perf_.csvɏ
+		using profile_ls = okl::ProfileOperator<okl::Profile::local_search, okl::PerfCounterOperator<okl::Profile::local_search, ls>>;
+		using profile_start = okl::ProfileOperator<okl::Profile::start, start>;
+		using profile_restart = okl::ProfileOperator<okl::Profile::restart, start>;
+
+		using mls = okl::MultiStartLocalSearch<profile_ls, profile_start, profile_restart, end_condition>;
+
+		//񑽃X^[gǏT Xbh0̓n[hEFA̕
+		using pmls = okl::ParallelMultiStartLocalSearch<profile_ls, profile_start, profile_restart, end_condition, 0>;
+
+		//Ht@CJnCăX^[g̓_ɍsX^[gǏT
+		using warm_start_mls = okl::MultiStartLocalSearch<profile_ls, okl::ProfileOperator<okl::Profile::start, tour_start>, profile_restart, end_condition>;
+
+		//ǏT dۓ̌́CߖTXg2-optqς[_݂̎̂𒲂ג
+		//ǏJԂ񐔂͋ǏT̉񐔂ɂȂ
+		//ǏT͉NXƂɌ^邽߁CWč̌^łp悤ɂ
+		template<class __Solution>
+		using ils_ls_of = okl::SearchPrePostOperator<ls_count, okl::LocalSearch<__Solution, okl::tsp::NeighborListRouteSwapOperator<>, not_best_cost_is_better_than_before>, okl::NoneOperator>;
+		template<class __Solution>
+		using profile_ils_ls_of = okl::ProfileOperator<okl::Profile::local_search, okl::PerfCounterOperator<okl::Profile::local_search, ils_ls_of<__Solution>>>;
+		using ils_ls = ils_ls_of<solution_type>;
+		using profile_ils_ls = profile_ils_ls_of<solution_type>;
+		using profile_perturbation = okl::ProfileOperator<okl::Profile::perturbation, okl::tsp::DoubleBridgePerturbationOperator<>>;
+		//󗝊 ǏœKŗǉ舫΍ŗǉɖ߂ĂۓClȂ猻݂̉ۓ
+		using restore_best_acceptance = okl::IfOperator<okl::NotCondition<okl::CostEqualBestSolutionCost>, okl::LoadBestSolutionOperator>;
+		using ils = okl::lteratedLocalSearch<profile_ils_ls, profile_start, okl::SequenceOperator<restore_best_acceptance, profile_perturbation>, end_condition>;
+
+		//`IASY ̑Ɍ𕡐CɓdۓƋߖTXg2-optĂeƎq̃G[gIs
+		//Wc̍ő̐͐eƎq̕v邽߁CWcTCY(ݒpop_size)2{ȏɂ
+		//ǏJԂ񐔂͐㐔ɂȂ
+		template<class __Population>
+		using memetic_ga = okl::GeneticAlgorithm<
+			__Population,
+			okl::BornPopulationDoOperator<okl::SequenceOperator<profile_start, profile_ils_ls_of<typename __Population::individual_type>>>,
+			okl::SequenceOperator<okl::CopyPresentGenerationOperator, okl::NextGenerationDoOperator<okl::SequenceOperator<profile_perturbation, profile_ils_ls_of<typename __Population::individual_type>>>>,
+			okl::NoneOperator,
+			okl::EliteSelectionOperator,
+			end_condition>;
+		using ga = memetic_ga<okl::Population<solution_type, 64>>;
+
+		//̂̏H1̘Äɂ܂Ƃ߂Wcp`IASY
+		using arena_ga = memetic_ga<arena_population_type<64>>;
+
+		//̂̐Ǝqւ̐ۓƋǏTXbhƂɕčs`IASY Xbh0̓n[hEFA̕
+		using parallel_ga = okl::GeneticAlgorithm<
+			okl::Population<solution_type, 64>,
+			okl::ParallelBornPopulationDoOperator<okl::SequenceOperator<profile_start, profile_ils_ls>, search_info_type, 0>,
+			okl::SequenceOperator<okl::CopyPresentGenerationOperator, okl::ParallelNextGenerationDoOperator<okl::SequenceOperator<profile_perturbation, profile_ils_ls>, search_info_type, 0>>,
+			okl::NoneOperator,
+			okl::EliteSelectionOperator,
+			end_condition>;
+
+		//f`IASY 0̓n[hEFA̕ 10ゲƂɃOɍŗǌ̂1ڏZ
+		using island_ga = okl::IslandGeneticAlgorithm<ga, okl::RingTopology, 0, 10, 1>;
+
+		using search = mls;
+		//H̊i[fBNgw肵ꍇ̒T
+		using warm_start_search = warm_start_mls;
+	};
+
+	//_65535ȉ̖̌^ HȂǂ̑傫ɂȂ
+	using types16 = Types<std::uint_least16_t>;
+	//_65535𒴂̌^
+	using types32 = Types<std::uint_least32_t>;
+
+	/*!
+	 * @brief			_ɍ^ꎮŊ֐Ăяo
+	 * @param[in]		__dimension _
+	 * @param[in]		__function ^ꎮɂƂ֐ ^ꎮ̒l͌^̑Î݂ɗp
+	 * @return			__function̖߂lԂ ̌^ꎮœ^ł邱
+	 */
+	template<class __Function>
+	decltype(auto) dispatchTypes(const std::size_t __dimension, __Function&& __function)
+	{
+		if (__dimension <= std::numeric_limits<types16::id_type>::max()) {
+			return __function(types16());
+		}
+		else {
+			return __function(types32());
+		}
+	}
+
+	//_ID^ɈˑȂ^ƁCx`}[NȂǂŗp̌^
+	using id_type = types16::id_type;
+	using edge_type = types16::edge_type;
+	using degree_type = types16::degree_type;
+	using cost_type = types16::cost_type;
+	using vertex_type = types16::vertex_type;
+	using stack_type = types16::stack_type;
+	using set_type = types16::set_type;
+	using graph_type = types16::graph_type;
+	using solution_type = types16::solution_type;
+	using arena_solution_type = types16::arena_solution_type;
+	template<std::size_t __MaxPopulationSize>
+	using arena_population_type = types16::arena_population_type<__MaxPopulationSize>;
+	using instance_type = types16::instance_type;
+	using cost_comparison_function = types16::cost_comparison_function;
+	using result_type = types16::result_type;
+	using info_type = types16::info_type;
+	using search_info_type = types16::search_info_type;
+	using start = types16::start;
+	using tour_start = types16::tour_start;
+	using end_condition = types16::end_condition;
+	using ls = types16::ls;
+	using mls = types16::mls;
+	using pmls = types16::pmls;
+	using warm_start_mls = types16::warm_start_mls;
+	using ils = types16::ils;
+	using ga = types16::ga;
+	using arena_ga = types16::arena_ga;
+	using parallel_ga = types16::parallel_ga;
+	using island_ga = types16::island_ga;
+	using search = types16::search;
+	using warm_start_search = types16::warm_start_search;
 } /* namespace okl::tsp */
\ No newline at end of file